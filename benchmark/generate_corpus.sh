@@ -0,0 +1,84 @@
+#!/bin/bash
+#
+# Fabricates a synthetic corpus for benchmarking:
+#   N professors x M categories x K PDFs per category, each PDF named
+#   NN_categoria_ano.pdf (the pattern the GUI's filename heuristics parse)
+#   with Title/Year/Category metadata embedded via exiftool when available.
+#
+# Usage: benchmark/generate_corpus.sh [N_PROFESSORS] [M_CATEGORIES] [K_PDFS] [DEST_DIR]
+
+set -e
+
+N_PROFESSORS="${1:-3}"
+M_CATEGORIES="${2:-4}"
+K_PDFS="${3:-25}"
+DEST_DIR="${4:-bench_corpus}"
+
+echo "Generating corpus: $N_PROFESSORS professor(s) x $M_CATEGORIES categoria(s) x $K_PDFS PDF(s) in '$DEST_DIR'"
+
+HAVE_EXIFTOOL=0
+command -v exiftool >/dev/null 2>&1 && HAVE_EXIFTOOL=1
+[ "$HAVE_EXIFTOOL" -eq 0 ] && echo "AVISO: exiftool não encontrado; PDFs serão gerados sem metadados embutidos."
+
+mkdir -p "$DEST_DIR/config" "$DEST_DIR/lista" "$DEST_DIR/final"
+
+# Writes a minimal one-page PDF to $1 (valid enough for exiftool and gs)
+write_minimal_pdf() {
+    cat > "$1" <<'PDFEOF'
+%PDF-1.4
+1 0 obj << /Type /Catalog /Pages 2 0 R >> endobj
+2 0 obj << /Type /Pages /Kids [3 0 R] /Count 1 >> endobj
+3 0 obj << /Type /Page /Parent 2 0 R /MediaBox [0 0 595 842] /Resources << >> >> endobj
+xref
+0 4
+0000000000 65535 f
+0000000009 00000 n
+0000000058 00000 n
+0000000115 00000 n
+trailer << /Size 4 /Root 1 0 R >>
+startxref
+204
+%%EOF
+PDFEOF
+}
+
+: > "$DEST_DIR/config/professores.txt"
+: > "$DEST_DIR/config/categories.txt"
+: > "$DEST_DIR/lista/professores.txt"
+
+for ((c = 1; c <= M_CATEGORIES; c++)); do
+    echo "Categoria $c" >> "$DEST_DIR/config/categories.txt"
+done
+
+total_pdfs=0
+for ((p = 1; p <= N_PROFESSORS; p++)); do
+    professor="Professor Teste $p"
+    echo "$professor" >> "$DEST_DIR/config/professores.txt"
+    echo "$professor" >> "$DEST_DIR/lista/professores.txt"
+
+    for ((c = 1; c <= M_CATEGORIES; c++)); do
+        categoria="Categoria $c"
+        pasta="$DEST_DIR/$professor/$categoria"
+        mkdir -p "$pasta"
+
+        for ((k = 1; k <= K_PDFS; k++)); do
+            ano=$((2015 + (k % 10)))
+            printf -v nn "%02d" "$k"
+            pdf_path="$pasta/${nn}_categoria${c}_${ano}.pdf"
+            write_minimal_pdf "$pdf_path"
+            total_pdfs=$((total_pdfs + 1))
+        done
+
+        if [ "$HAVE_EXIFTOOL" -eq 1 ]; then
+            # One exiftool run per folder; per-file tags via -fileNUM would
+            # need an argfile, so embed the shared tags and vary Title by file
+            exiftool -q -overwrite_original_in_place \
+                     -Category="$categoria" \
+                     -Year=2020 \
+                     '-Title<${FileName;s/\.pdf$//}' \
+                     "$pasta" >/dev/null 2>&1 || true
+        fi
+    done
+done
+
+echo "Corpus pronto: $total_pdfs PDF(s) em '$DEST_DIR'."
@@ -0,0 +1,134 @@
+#!/bin/bash
+#
+# Timed driver for the three hot paths, run against a corpus produced by
+# benchmark/generate_corpus.sh:
+#
+#   scan    - batched exiftool metadata read per category folder (the cost
+#             process_pdf_folder() pays on professor selection, cold cache)
+#   save    - copy every PDF to a staging dir + one argfile-batched exiftool
+#             metadata write (the save-all pipeline's two costs)
+#   report  - full generation via the GUI binary's --headless mode when a
+#             binary is given, otherwise the backend script directly
+#
+# Each phase reports wall-clock seconds, subprocess count and peak RSS.
+# REPORT_GUI_TRACE=all is exported so headless runs also print the
+# instrumentation summary table.
+#
+# Usage: benchmark/run_benchmark.sh [CORPUS_DIR] [REPORT_GUI_BINARY]
+
+set -e
+
+CORPUS_DIR="${1:-bench_corpus}"
+GUI_BINARY="${2:-}"
+
+[ -d "$CORPUS_DIR" ] || { echo "ERRO: corpus '$CORPUS_DIR' não encontrado. Execute benchmark/generate_corpus.sh primeiro."; exit 1; }
+command -v exiftool >/dev/null 2>&1 || { echo "ERRO: exiftool não encontrado."; exit 1; }
+
+TIME_BIN=""
+[ -x /usr/bin/time ] && TIME_BIN=/usr/bin/time
+PHASE_FAILURES=0
+
+# run_phase <name> <subprocess-count> <command...>
+# Wall clock comes from bash; peak RSS from /usr/bin/time -v when available.
+# A non-zero child exit is reported and fails the benchmark at the end --
+# a near-zero wall time for a phase that silently did nothing is worse
+# than no number at all.
+run_phase() {
+    local phase="$1"; shift
+    local subprocesses="$1"; shift
+
+    local rss="n/a"
+    local rc=0
+    local start_ns=$(date +%s%N)
+    if [ -n "$TIME_BIN" ]; then
+        local time_out
+        time_out=$(mktemp)
+        "$TIME_BIN" -v -o "$time_out" "$@" > /dev/null 2>&1 || rc=$?
+        rss="$(awk -F': ' '/Maximum resident set size/ {print $2 " kB"}' "$time_out")"
+        rm -f "$time_out"
+    else
+        "$@" > /dev/null 2>&1 || rc=$?
+    fi
+    local end_ns=$(date +%s%N)
+
+    printf "%-8s wall=%6.2fs  subprocesses=%-4s peak_rss=%s\n" \
+           "$phase" "$(echo "scale=2; ($end_ns - $start_ns) / 1000000000" | bc)" \
+           "$subprocesses" "$rss"
+    if [ "$rc" -ne 0 ]; then
+        echo "ERRO: fase '$phase' terminou com código $rc."
+        PHASE_FAILURES=$((PHASE_FAILURES + 1))
+    fi
+}
+
+cd "$CORPUS_DIR"
+export REPORT_GUI_TRACE=all
+
+echo "===== benchmark: $(pwd) ====="
+
+# --- Phase 1: scan (one batched read per category folder) ---
+scan_count=0
+scan_script=$(mktemp)
+{
+    echo '#!/bin/bash'
+    while IFS= read -r professor; do
+        [ -z "$professor" ] && continue
+        while IFS= read -r categoria; do
+            [ -z "$categoria" ] && continue
+            [ -d "$professor/$categoria" ] || continue
+            printf 'exiftool -j -Title -Year -Category -PageCount %q > /dev/null 2>&1\n' "$professor/$categoria"
+            scan_count=$((scan_count + 1))
+        done < config/categories.txt
+    done < config/professores.txt
+} > "$scan_script"
+chmod +x "$scan_script"
+run_phase "scan" "$scan_count" "$scan_script"
+rm -f "$scan_script"
+
+# --- Phase 2: save (copy + one batched metadata write) ---
+save_script=$(mktemp)
+save_staging=$(mktemp -d)
+save_argfile=$(mktemp)
+save_files=0
+while IFS= read -r -d '' pdf; do
+    dest="$save_staging/$(echo "$pdf" | tr '/' '_')"
+    printf 'cp %q %q\n' "$pdf" "$dest" >> "$save_script.cp"
+    {
+        echo "-charset"; echo "utf8"
+        echo "-Title=Benchmark Save"
+        echo "-Year=2024"
+        echo "-overwrite_original_in_place"
+        echo "$dest"
+        echo "-execute"
+    } >> "$save_argfile"
+    save_files=$((save_files + 1))
+done < <(find . -mindepth 3 -maxdepth 3 -name "*.pdf" -not -path "*/old_files/*" -print0)
+{
+    echo '#!/bin/bash'
+    cat "$save_script.cp"
+    printf 'exiftool -@ %q > /dev/null 2>&1\n' "$save_argfile"
+} > "$save_script"
+chmod +x "$save_script"
+run_phase "save" "1" "$save_script"
+rm -rf "$save_staging" "$save_script" "$save_script.cp" "$save_argfile"
+
+# --- Phase 3: report (headless binary when available, else backend script) ---
+if [ -n "$GUI_BINARY" ] && [ -x "$GUI_BINARY" ]; then
+    # --headless spawns the cwd-relative backend script, so the corpus
+    # needs its own copy just like the script-only branch below.
+    [ -f ../generate_pdf_professor_v2.0.2-R22.sh ] && cp ../generate_pdf_professor_v2.0.2-R22.sh .
+    run_phase "report" "see-trace" "$GUI_BINARY" --headless all
+    rm -f ./generate_pdf_professor_v2.0.2-R22.sh
+elif [ -f ../generate_pdf_professor_v2.0.2-R22.sh ]; then
+    first_professor=$(head -n 1 config/professores.txt)
+    cp ../generate_pdf_professor_v2.0.2-R22.sh .
+    run_phase "report" "n/a" bash ./generate_pdf_professor_v2.0.2-R22.sh "$first_professor"
+    rm -f ./generate_pdf_professor_v2.0.2-R22.sh
+else
+    echo "report   pulado (sem binário --headless e sem script de backend)"
+fi
+
+if [ "$PHASE_FAILURES" -gt 0 ]; then
+    echo "===== benchmark FALHOU: $PHASE_FAILURES fase(s) com erro ====="
+    exit 1
+fi
+echo "===== benchmark concluído ($save_files PDF(s)) ====="
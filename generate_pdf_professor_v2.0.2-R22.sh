@@ -98,6 +98,244 @@ process_metadata() {
 }
 
 
+# Fingerprint of a category's input set: the precomputed first doc id plus
+# name, mtime and size of every source PDF in processing order. If it matches
+# the previous run, the category's doc_N.pdf files and TeX fragment can be
+# reused verbatim.
+category_fingerprint() {
+    local caminho_pasta="$1"
+    local first_doc_id="$2"
+    {
+        echo "$first_doc_id"
+        find "$caminho_pasta" -maxdepth 1 -name "*.pdf" -print0 | sort -V -z | \
+            xargs -0 -r stat -c '%n %Y %s' 2>/dev/null
+    } | md5sum | cut -d' ' -f1
+}
+
+# True if the fragment and every doc_N.pdf produced for this category on the
+# previous run are still present in the temp directory
+category_artifacts_present() {
+    local TEMP_DIR="$1"
+    local pasta_index="$2"
+    local first_doc_id="$3"
+    local count="$4"
+    local FRAG
+    printf -v FRAG "%s/section_%03d.tex" "$TEMP_DIR" "$pasta_index"
+    [ -f "$FRAG" ] || return 1
+    local id
+    for ((id = first_doc_id; id < first_doc_id + count; id++)); do
+        [ -f "$TEMP_DIR/doc_${id}.pdf" ] || return 1
+    done
+    return 0
+}
+
+# Prepares one category as an isolated background job: converts its PDFs and
+# writes its TeX fragment to section_NNN.tex. Document ids are precomputed by
+# the caller, so the concatenated output is byte-identical to the old serial
+# walk regardless of job completion order.
+process_category_job() {
+    local current_professor_name="$1"
+    local PROFESSOR_DIR="$2"
+    local TEMP_DIR="$3"
+    local pasta="$4"
+    local pasta_index="$5"
+    local first_doc_id="$6"
+    local PROFESSOR_ESCAPE="$7"
+
+    local caminho_pasta="$PROFESSOR_DIR/$pasta"
+    local FRAG
+    printf -v FRAG "%s/section_%03d.tex" "$TEMP_DIR" "$pasta_index"
+
+    [ -d "$caminho_pasta" ] || { rm -f "$FRAG"; return 0; }
+
+    # Obter PDFs ordenados numericamente
+    local -a pdfs
+    mapfile -d '' pdfs < <(find "$caminho_pasta" -maxdepth 1 -name "*.pdf" -print0 | sort -V -z)
+
+    # Empty category: drop any fragment kept from a previous run, or it
+    # would be concatenated again with doc ids that now belong to later
+    # categories after renumbering
+    [ ${#pdfs[@]} -gt 0 ] || { rm -f "$FRAG"; return 0; }
+
+    : > "$FRAG"
+
+    # Process section name
+    local SECTION_NAME=$(echo "$pasta" | sed -e 's/[&%$#_{}\\~^]/\\&/g')
+
+    # Add section to LaTeX
+    echo "\\clearpage" >> "$FRAG"
+    echo "\\section*{$SECTION_NAME}" >> "$FRAG"
+    echo "\\addcontentsline{toc}{section}{$SECTION_NAME}" >> "$FRAG"
+    echo "\\pdfbookmark[1]{$SECTION_NAME}{sec_${pasta//[^a-zA-Z]/_}}" >> "$FRAG"
+
+    # CRITICAL SECTION ADDITION
+    local FIRST_DOC_ID=$first_doc_id
+
+    echo "\\vspace{1cm}" >> "$FRAG"
+    echo "\\begin{minipage}{\\textwidth}" >> "$FRAG"
+    echo "\\fontsize{12}{14}\\selectfont" >> "$FRAG"
+
+    local count=${#pdfs[@]}
+    local plural_phrase="documentos"
+    local article="os"
+    local referentes="referentes"
+    local verb="são apresentados"
+
+    if [ "$count" -eq 1 ]; then
+        plural_phrase="documento"
+        article="o"
+        verb="é apresentado"
+        referentes="referente"
+    fi
+
+    local DATE_RANGE_CLAUSE=""
+    if [[ "$SECTION_NAME" == "Produção Docente" ]]; then
+        DATE_RANGE_CLAUSE=", cobrindo o período de 2022 a 2024"
+    fi
+
+    echo "\\noindent Nesta seção, $article \\textbf{$count} $plural_phrase $referentes a \\textbf{$SECTION_NAME} de \\textbf{$PROFESSOR_ESCAPE} $verb a seguir (\\hyperlink{startdoc$FIRST_DOC_ID}{\\color{blue}\\underline{clique aqui}})$DATE_RANGE_CLAUSE. Utilize o sistema de navegação no canto superior direito da página para retornar ao Sumário." >> "$FRAG"
+    echo "\\end{minipage}" >> "$FRAG"
+    echo "\\vspace{1.5cm}" >> "$FRAG"
+    # END CRITICAL SECTION ADDITION
+
+    # Processar PDFs em ordem (doc ids continue from the precomputed offset)
+    local doc_number=0
+    local doc_global=$((first_doc_id - 1))
+    local doc_num
+    local pdf
+
+    for pdf in "${pdfs[@]}"; do
+        ((doc_global++))
+        ((doc_number++))
+        printf -v doc_num "%02d" "$doc_number"
+
+        # --- REVISED YEAR EXTRACTION LOGIC: PRIORITIZE METADATA DATES FROM ORIGINAL PDF ---
+        local YEAR=""
+        local METADATA_YEAR_FOUND="false"
+
+        # Exiftool needs to operate on the ORIGINAL PDF for accurate metadata extraction
+        # 1. Try DateTimeOriginal
+        local DATETIMEORIGINAL_RAW=$(exiftool -DateTimeOriginal -s -s -s "$pdf" 2>/dev/null)
+        if [ -n "$DATETIMEORIGINAL_RAW" ]; then
+            if [[ "$DATETIMEORIGINAL_RAW" =~ ^([0-9]{4}) ]]; then # Extract first 4 digits (year)
+                YEAR="${BASH_REMATCH[1]}"
+                METADATA_YEAR_FOUND="true"
+            fi
+        fi
+
+        # 2. If not found or invalid, try CreateDate
+        if [ "$METADATA_YEAR_FOUND" = "false" ]; then
+            local CREATEDATE_RAW=$(exiftool -CreateDate -s -s -s "$pdf" 2>/dev/null)
+            if [ -n "$CREATEDATE_RAW" ]; then
+                if [[ "$CREATEDATE_RAW" =~ ^([0-9]{4}) ]]; then
+                    YEAR="${BASH_REMATCH[1]}"
+                    METADATA_YEAR_FOUND="true"
+                fi
+            fi
+        fi
+
+        # 3. If still no year from date metadata, try ModifyDate
+        if [ "$METADATA_YEAR_FOUND" = "false" ]; then
+            local MODIFYDATE_RAW=$(exiftool -ModifyDate -s -s -s "$pdf" 2>/dev/null)
+            if [ -n "$MODIFYDATE_RAW" ]; then
+                if [[ "$MODIFYDATE_RAW" =~ ^([0-9]{4}) ]]; then
+                    YEAR="${BASH_REMATCH[1]}"
+                    METADATA_YEAR_FOUND="true"
+                fi
+            fi
+        fi
+
+        # 4. If still no year from date metadata, try the "Year" tag from original PDF
+        if [ "$METADATA_YEAR_FOUND" = "false" ]; then
+            local YEAR_TAG_RAW=$(exiftool -Year -s -s -s "$pdf" 2>/dev/null)
+            if [ -n "$YEAR_TAG_RAW" ]; then
+                if [[ "$YEAR_TAG_RAW" =~ ^([0-9]{4})$ ]]; then # Ensure it's exactly 4 digits
+                    YEAR="${BASH_REMATCH[1]}"
+                    METADATA_YEAR_FOUND="true"
+                fi
+            fi
+        fi
+
+        # 5. Fallback to filename if all metadata extraction failed
+        if [ "$METADATA_YEAR_FOUND" = "false" ]; then
+            local FILENAME_NO_EXT=$(basename "$pdf" .pdf)
+            local EXTRACTED_YEAR_FROM_FILENAME=$(echo "$FILENAME_NO_EXT" | grep -oP '(\d{4})$' | tail -n 1)
+            if [ -n "$EXTRACTED_YEAR_FROM_FILENAME" ]; then
+                YEAR="$EXTRACTED_YEAR_FROM_FILENAME"
+            fi
+        fi
+
+        # Final fallback if no year could be determined
+        if [ -z "$YEAR" ]; then
+            YEAR="Ano Desconhecido"
+        fi
+        # --- END REVISED YEAR EXTRACTION LOGIC ---
+
+        local SAFE_NAME="doc_${doc_global}.pdf"
+
+        # Conversão original da v1.1 (sem injeção de título)
+        # This gs command will likely set its own CreationDate/ModDate metadata,
+        # but we have already extracted the YEAR from the original PDF.
+        gs -q -dNOPAUSE -dBATCH -sDEVICE=pdfwrite \
+           -dCompatibilityLevel=1.7 \
+           -dPDFSETTINGS=/prepress \
+           -sOutputFile="$TEMP_DIR/$SAFE_NAME" \
+           "$pdf"
+
+        # Extract TITLE from metadata (retained original logic, operating on SAFE_NAME now)
+        local TITLE=$(exiftool -Title -s -s -s "$TEMP_DIR/$SAFE_NAME" 2>/dev/null || basename "$pdf" .pdf)
+        TITLE=$(echo "$TITLE" | sed -e 's/[&%$#_{}\\~^]/\\&/g')
+
+        # Now, explicitly set the YEAR tag in the new SAFE_NAME PDF using the extracted YEAR
+        exiftool -q -overwrite_original -Year="$YEAR" "$TEMP_DIR/$SAFE_NAME"
+
+        log "Processing PDF: $pdf"
+        log "Extracted Title: \"$TITLE\""
+        log "Extracted Year: \"$YEAR\" (from original metadata or filename)"
+
+        # Conditional addition of YEAR to subsection and TOC based on SECTION_NAME
+        if [[ "$SECTION_NAME" == "Produção Docente" ]]; then
+            echo "\\clearpage" >> "$FRAG"
+            echo "\\subsection*{$doc_num - $TITLE ($YEAR)}" >> "$FRAG"
+            echo "\\addcontentsline{toc}{subsection}{$doc_num - $TITLE ($YEAR)}" >> "$FRAG"
+            echo "\\pdfbookmark[2]{$doc_num - $TITLE ($YEAR)}{doc$doc_global}" >> "$FRAG"
+            # Text for the current subsection, including year
+            echo "\\vspace{1cm}" >> "$FRAG"
+            echo "\\begin{minipage}{\\textwidth}" >> "$FRAG"
+            echo "\\fontsize{12}{14}\\selectfont" >> "$FRAG"
+            echo "\\noindent Nesta subseção, a leitura do documento \\textbf{$doc_num - $TITLE ($YEAR)} pode ser realizada na próxima página (\\hyperlink{startdoc$doc_global}{\\color{blue}\\underline{clique aqui}}). Utilize o sistema de navegação no canto superior direito da página para retornar ao Sumário." >> "$FRAG"
+            echo "\\end{minipage}" >> "$FRAG"
+            echo "\\vspace{1.5cm}" >> "$FRAG"
+        else
+            # Adição ao documento (without YEAR)
+            echo "\\clearpage" >> "$FRAG"
+            echo "\\subsection*{$doc_num - $TITLE}" >> "$FRAG"
+            echo "\\addcontentsline{toc}{subsection}{$doc_num - $TITLE}" >> "$FRAG"
+            echo "\\pdfbookmark[2]{$doc_num - $TITLE}{doc$doc_global}" >> "$FRAG"
+            # Text for the current subsection, without year
+            echo "\\vspace{1cm}" >> "$FRAG"
+            echo "\\begin{minipage}{\\textwidth}" >> "$FRAG"
+            echo "\\fontsize{12}{14}\\selectfont" >> "$FRAG"
+            echo "\\noindent Nesta subseção, a leitura do documento \\textbf{$doc_num - $TITLE} pode ser realizada na próxima página (\\hyperlink{startdoc$doc_global}{\\color{blue}\\underline{clique aqui}}). Utilize o sistema de navegação no canto superior direito da página para retornar ao Sumário." >> "$FRAG"
+            echo "\\end{minipage}" >> "$FRAG"
+            echo "\\vspace{1.5cm}" >> "$FRAG"
+        fi
+
+    # Add this RIGHT BEFORE including the PDF
+    echo "\\newpage" >> "$FRAG"
+    echo "\\hypertarget{startdoc$doc_global}{}" >> "$FRAG"
+
+    # Then include the PDF
+    echo "\\includepdf[pages=-,pagecommand={\\thispagestyle{fancy}}]{$SAFE_NAME}" >> "$FRAG"
+
+        log "Processado: $pdf → $SAFE_NAME (Número: $doc_num)"
+
+        # One line per converted PDF, keyed as in the page-count manifest;
+        # the parent polls this for PROGRESS
+        echo "${pasta}/$(basename "$pdf")" >> "$TEMP_DIR/.progress_count"
+    done
+}
+
 generate_report() {
 
     local current_professor_name="$1" # Renamed for clarity within this function
@@ -156,13 +394,36 @@ generate_report() {
     unset IFS
 
     # --- PROGRESS CALCULATION START ---
+    # Page-count manifest exported by the GUI (category/basename<TAB>pages).
+    # When every PDF is covered, PROGRESS is weighted by pages instead of
+    # file count; any gap falls back to per-file weighting for the whole run.
+    local -A PAGE_COUNTS=()
+    local have_page_manifest=0
+    if [ -f "$TEMP_DIR/.page_counts" ]; then
+        while IFS=$'\t' read -r pc_key pc_pages; do
+            [ -n "$pc_key" ] && PAGE_COUNTS["$pc_key"]=$pc_pages
+        done < "$TEMP_DIR/.page_counts"
+        [ ${#PAGE_COUNTS[@]} -gt 0 ] && have_page_manifest=1
+    fi
+
     local total_pdfs_expected_for_professor=0
+    local total_pages_expected_for_professor=0
     for pasta_count_pdfs in "${pastas[@]}"; do
         local caminho_pasta_count_pdfs="$PROFESSOR_DIR/$pasta_count_pdfs"
         if [ -d "$caminho_pasta_count_pdfs" ]; then
-            total_pdfs_expected_for_professor=$((total_pdfs_expected_for_professor + $(find "$caminho_pasta_count_pdfs" -maxdepth 1 -name "*.pdf" | wc -l)))
+            local pdf_for_count
+            while IFS= read -r pdf_for_count; do
+                ((total_pdfs_expected_for_professor++))
+                local pc_key="${pasta_count_pdfs}/$(basename "$pdf_for_count")"
+                if [ -n "${PAGE_COUNTS[$pc_key]:-}" ]; then
+                    total_pages_expected_for_professor=$((total_pages_expected_for_professor + PAGE_COUNTS[$pc_key]))
+                else
+                    have_page_manifest=0
+                fi
+            done < <(find "$caminho_pasta_count_pdfs" -maxdepth 1 -name "*.pdf")
         fi
     done
+    [ "$total_pages_expected_for_professor" -gt 0 ] || have_page_manifest=0
 
     # Initial progress report
     echo "PROGRESS: 0"
@@ -237,196 +498,115 @@ TEX
 # Pré-processar nome do professor para LaTeX
 local PROFESSOR_ESCAPE=$(echo "$current_professor_name" | sed -e 's/[&%$#_{}\\~^]/\\&/g' -e 's/\\\\/\\backslash/g')
 
+# Per-category preparation runs as parallel jobs sharing the same slot
+# limiter used by batch mode, joining before the final concatenation. Doc ids
+# are precomputed serially so hyperlink targets and bookmark names match the
+# old serial output exactly.
+local -a category_first_ids=()
+local -a category_pdf_counts=()
+local next_doc_id=1
+local pasta_index=0
 for pasta in "${pastas[@]}"; do
     caminho_pasta="$PROFESSOR_DIR/$pasta"
-
-    [ -d "$caminho_pasta" ] || continue
-
-    # Obter PDFs ordenados numericamente
-    declare -a pdfs
-    mapfile -d '' pdfs < <(find "$caminho_pasta" -maxdepth 1 -name "*.pdf" -print0 | sort -V -z)
-
-    [ ${#pdfs[@]} -gt 0 ] || continue
-
-    # Process section name
-    local SECTION_NAME=$(echo "$pasta" | sed -e 's/[&%$#_{}\\~^]/\\&/g')
-
-    # Add section to LaTeX
-    echo "\\clearpage" >> "$TEMP_DIR/metadata.tex"
-    echo "\\section*{$SECTION_NAME}" >> "$TEMP_DIR/metadata.tex"
-    echo "\\addcontentsline{toc}{section}{$SECTION_NAME}" >> "$TEMP_DIR/metadata.tex"
-    echo "\\pdfbookmark[1]{$SECTION_NAME}{sec_${pasta//[^a-zA-Z]/_}}" >> "$TEMP_DIR/metadata.tex"
-
-    # CRITICAL SECTION ADDITION
-    local FIRST_DOC_ID=$((total_pdfs_processed_for_professor + 1))
-
-    echo "\\vspace{1cm}" >> "$TEMP_DIR/metadata.tex"
-    echo "\\begin{minipage}{\\textwidth}" >> "$TEMP_DIR/metadata.tex"
-    echo "\\fontsize{12}{14}\\selectfont" >> "$TEMP_DIR/metadata.tex"
-
-
-    local count=${#pdfs[@]}
-    local plural_phrase="documentos"
-    local article="os"
-    local referentes="referentes"
-    local verb="são apresentados"
-
-    if [ "$count" -eq 1 ]; then
-        plural_phrase="documento"
-        article="o"
-        verb="é apresentado"
-        referentes="referente"
+    local pasta_pdf_count=0
+    if [ -d "$caminho_pasta" ]; then
+        pasta_pdf_count=$(find "$caminho_pasta" -maxdepth 1 -name "*.pdf" | wc -l)
     fi
+    category_first_ids[$pasta_index]=$next_doc_id
+    category_pdf_counts[$pasta_index]=$pasta_pdf_count
+    next_doc_id=$((next_doc_id + pasta_pdf_count))
+    ((pasta_index++))
+done
 
-    local DATE_RANGE_CLAUSE=""
-    if [[ "$SECTION_NAME" == "Produção Docente" ]]; then
-        DATE_RANGE_CLAUSE=", cobrindo o período de 2022 a 2024"
-    fi
-
-
-    echo "\\noindent Nesta seção, $article \\textbf{$count} $plural_phrase $referentes a \\textbf{$SECTION_NAME} de \\textbf{$PROFESSOR_ESCAPE} $verb a seguir (\\hyperlink{startdoc$FIRST_DOC_ID}{\\color{blue}\\underline{clique aqui}})$DATE_RANGE_CLAUSE. Utilize o sistema de navegação no canto superior direito da página para retornar ao Sumário." >> "$TEMP_DIR/metadata.tex"
-    echo "\\end{minipage}" >> "$TEMP_DIR/metadata.tex"
-    echo "\\vspace{1.5cm}" >> "$TEMP_DIR/metadata.tex"
-    # END CRITICAL SECTION ADDITION
-
-    # Processar PDFs em ordem (loop modificado)
-    doc_number=0
-
-    for pdf in "${pdfs[@]}"; do
-        ((total_pdfs_processed_for_professor++))
-        ((doc_number++))
-        printf -v doc_num "%02d" "$doc_number"
-
-        # --- REVISED YEAR EXTRACTION LOGIC: PRIORITIZE METADATA DATES FROM ORIGINAL PDF ---
-        local YEAR=""
-        local METADATA_YEAR_FOUND="false"
-
-        # Exiftool needs to operate on the ORIGINAL PDF for accurate metadata extraction
-        # 1. Try DateTimeOriginal
-        local DATETIMEORIGINAL_RAW=$(exiftool -DateTimeOriginal -s -s -s "$pdf" 2>/dev/null)
-        if [ -n "$DATETIMEORIGINAL_RAW" ]; then
-            if [[ "$DATETIMEORIGINAL_RAW" =~ ^([0-9]{4}) ]]; then # Extract first 4 digits (year)
-                YEAR="${BASH_REMATCH[1]}"
-                METADATA_YEAR_FOUND="true"
-            fi
-        fi
-
-        # 2. If not found or invalid, try CreateDate
-        if [ "$METADATA_YEAR_FOUND" = "false" ]; then
-            local CREATEDATE_RAW=$(exiftool -CreateDate -s -s -s "$pdf" 2>/dev/null)
-            if [ -n "$CREATEDATE_RAW" ]; then
-                if [[ "$CREATEDATE_RAW" =~ ^([0-9]{4}) ]]; then
-                    YEAR="${BASH_REMATCH[1]}"
-                    METADATA_YEAR_FOUND="true"
-                fi
-            fi
-        fi
-
-        # 3. If still no year from date metadata, try ModifyDate
-        if [ "$METADATA_YEAR_FOUND" = "false" ]; then
-            local MODIFYDATE_RAW=$(exiftool -ModifyDate -s -s -s "$pdf" 2>/dev/null)
-            if [ -n "$MODIFYDATE_RAW" ]; then
-                if [[ "$MODIFYDATE_RAW" =~ ^([0-9]{4}) ]]; then
-                    YEAR="${BASH_REMATCH[1]}"
-                    METADATA_YEAR_FOUND="true"
-                fi
-            fi
-        fi
-        
-        # 4. If still no year from date metadata, try the "Year" tag from original PDF
-        if [ "$METADATA_YEAR_FOUND" = "false" ]; then
-            local YEAR_TAG_RAW=$(exiftool -Year -s -s -s "$pdf" 2>/dev/null)
-            if [ -n "$YEAR_TAG_RAW" ]; then
-                if [[ "$YEAR_TAG_RAW" =~ ^([0-9]{4})$ ]]; then # Ensure it's exactly 4 digits
-                    YEAR="${BASH_REMATCH[1]}"
-                    METADATA_YEAR_FOUND="true"
-                fi
-            fi
-        fi
+# Manifest from the previous run: one "index<TAB>fingerprint" line per
+# category, kept alongside the artifacts under TEMP_DIR_BASE
+local MANIFEST_FILE="$TEMP_DIR/.manifest"
+local -A manifest_fp=()
+if [ -f "$MANIFEST_FILE" ]; then
+    while IFS=$'\t' read -r m_idx m_fp; do
+        [ -n "$m_idx" ] && manifest_fp[$m_idx]="$m_fp"
+    done < "$MANIFEST_FILE"
+fi
+local -a category_fps=()
 
-        # 5. Fallback to filename if all metadata extraction failed
-        if [ "$METADATA_YEAR_FOUND" = "false" ]; then
-            local FILENAME_NO_EXT=$(basename "$pdf" .pdf)
-            local EXTRACTED_YEAR_FROM_FILENAME=$(echo "$FILENAME_NO_EXT" | grep -oP '(\d{4})$' | tail -n 1)
-            if [ -n "$EXTRACTED_YEAR_FROM_FILENAME" ]; then
-                YEAR="$EXTRACTED_YEAR_FROM_FILENAME"
-            fi
+: > "$TEMP_DIR/.progress_count"
+local category_active_jobs=0
+local -a category_pids=()
+pasta_index=0
+for pasta in "${pastas[@]}"; do
+    if [ -d "$PROFESSOR_DIR/$pasta" ]; then
+        local category_fp=$(category_fingerprint "$PROFESSOR_DIR/$pasta" "${category_first_ids[$pasta_index]}")
+        category_fps[$pasta_index]="$category_fp"
+        if [ "${manifest_fp[$pasta_index]:-}" = "$category_fp" ] && \
+           category_artifacts_present "$TEMP_DIR" "$pasta_index" \
+                                      "${category_first_ids[$pasta_index]}" \
+                                      "${category_pdf_counts[$pasta_index]}"; then
+            log "Reutilizando artefatos de '$pasta' (entradas inalteradas)"
+            # Count the reused conversions toward progress reporting
+            local reused_pdf
+            while IFS= read -r reused_pdf; do
+                echo "${pasta}/$(basename "$reused_pdf")" >> "$TEMP_DIR/.progress_count"
+            done < <(find "$PROFESSOR_DIR/$pasta" -maxdepth 1 -name "*.pdf")
+            ((pasta_index++))
+            continue
         fi
-
-        # Final fallback if no year could be determined
-        if [ -z "$YEAR" ]; then
-            YEAR="Ano Desconhecido"
+        if (( category_active_jobs >= MAX_CONCURRENT_JOBS )); then
+            wait -n
+            ((category_active_jobs--))
         fi
-        # --- END REVISED YEAR EXTRACTION LOGIC ---
-
-        local SAFE_NAME="doc_${total_pdfs_processed_for_professor}.pdf"
-
-        # Conversão original da v1.1 (sem injeção de título)
-        # This gs command will likely set its own CreationDate/ModDate metadata,
-        # but we have already extracted the YEAR from the original PDF.
-        gs -q -dNOPAUSE -dBATCH -sDEVICE=pdfwrite \
-           -dCompatibilityLevel=1.7 \
-           -dPDFSETTINGS=/prepress \
-           -sOutputFile="$TEMP_DIR/$SAFE_NAME" \
-           "$pdf"
-
-        # Extract TITLE from metadata (retained original logic, operating on SAFE_NAME now)
-        # Note: Title extraction is still from the (potentially re-generated) SAFE_NAME.
-        # If original title is needed consistently, this would also need to happen on '$pdf' before gs.
-        local TITLE=$(exiftool -Title -s -s -s "$TEMP_DIR/$SAFE_NAME" 2>/dev/null || basename "$pdf" .pdf)
-        TITLE=$(echo "$TITLE" | sed -e 's/[&%$#_{}\\~^]/\\&/g')
-
-        # Now, explicitly set the YEAR tag in the new SAFE_NAME PDF using the extracted YEAR
-        exiftool -q -overwrite_original -Year="$YEAR" "$TEMP_DIR/$SAFE_NAME"
-
-        log "Processing PDF: $pdf"
-        log "Extracted Title: \"$TITLE\""
-        log "Extracted Year: \"$YEAR\" (from original metadata or filename)"
+        process_category_job "$current_professor_name" "$PROFESSOR_DIR" "$TEMP_DIR" \
+                             "$pasta" "$pasta_index" "${category_first_ids[$pasta_index]}" \
+                             "$PROFESSOR_ESCAPE" &
+        category_pids+=($!)
+        ((category_active_jobs++))
+    else
+        # Category folder no longer exists: drop any stale cached fragment
+        local FRAG
+        printf -v FRAG "%s/section_%03d.tex" "$TEMP_DIR" "$pasta_index"
+        rm -f "$FRAG"
+    fi
+    ((pasta_index++))
+done
 
-        # Conditional addition of YEAR to subsection and TOC based on SECTION_NAME
-        if [[ "$SECTION_NAME" == "Produção Docente" ]]; then
-            echo "\\clearpage" >> "$TEMP_DIR/metadata.tex"
-            echo "\\subsection*{$doc_num - $TITLE ($YEAR)}" >> "$TEMP_DIR/metadata.tex"
-            echo "\\addcontentsline{toc}{subsection}{$doc_num - $TITLE ($YEAR)}" >> "$TEMP_DIR/metadata.tex"
-            echo "\\pdfbookmark[2]{$doc_num - $TITLE ($YEAR)}{doc$total_pdfs_processed_for_professor}" >> "$TEMP_DIR/metadata.tex"
-            # Text for the current subsection, including year
-            echo "\\vspace{1cm}" >> "$TEMP_DIR/metadata.tex"
-            echo "\\begin{minipage}{\\textwidth}" >> "$TEMP_DIR/metadata.tex"
-            echo "\\fontsize{12}{14}\\selectfont" >> "$TEMP_DIR/metadata.tex"
-            echo "\\noindent Nesta subseção, a leitura do documento \\textbf{$doc_num - $TITLE ($YEAR)} pode ser realizada na próxima página (\\hyperlink{startdoc$total_pdfs_processed_for_professor}{\\color{blue}\\underline{clique aqui}}). Utilize o sistema de navegação no canto superior direito da página para retornar ao Sumário." >> "$TEMP_DIR/metadata.tex"
-            echo "\\end{minipage}" >> "$TEMP_DIR/metadata.tex"
-            echo "\\vspace{1.5cm}" >> "$TEMP_DIR/metadata.tex"
-        else
-            # Adição ao documento (without YEAR)
-            echo "\\clearpage" >> "$TEMP_DIR/metadata.tex"
-            echo "\\subsection*{$doc_num - $TITLE}" >> "$TEMP_DIR/metadata.tex"
-            echo "\\addcontentsline{toc}{subsection}{$doc_num - $TITLE}" >> "$TEMP_DIR/metadata.tex"
-            echo "\\pdfbookmark[2]{$doc_num - $TITLE}{doc$total_pdfs_processed_for_professor}" >> "$TEMP_DIR/metadata.tex"
-            # Text for the current subsection, without year
-            echo "\\vspace{1cm}" >> "$TEMP_DIR/metadata.tex"
-            echo "\\begin{minipage}{\\textwidth}" >> "$TEMP_DIR/metadata.tex"
-            echo "\\fontsize{12}{14}\\selectfont" >> "$TEMP_DIR/metadata.tex"
-            echo "\\noindent Nesta subseção, a leitura do documento \\textbf{$doc_num - $TITLE} pode ser realizada na próxima página (\\hyperlink{startdoc$total_pdfs_processed_for_professor}{\\color{blue}\\underline{clique aqui}}). Utilize o sistema de navegação no canto superior direito da página para retornar ao Sumário." >> "$TEMP_DIR/metadata.tex"
-            echo "\\end{minipage}" >> "$TEMP_DIR/metadata.tex"
-            echo "\\vspace{1.5cm}" >> "$TEMP_DIR/metadata.tex"
+# Join, reporting conversion progress from the shared counter file while
+# jobs are still running
+for pid in "${category_pids[@]}"; do
+    while kill -0 "$pid" 2>/dev/null; do
+        if [ "$have_page_manifest" -eq 1 ]; then
+            local pages_done=0 pc_line
+            while IFS= read -r pc_line; do
+                pages_done=$((pages_done + ${PAGE_COUNTS[$pc_line]:-1}))
+            done < "$TEMP_DIR/.progress_count"
+            echo "PROGRESS: $((pages_done * 90 / total_pages_expected_for_professor))"
+        elif [ "$total_pdfs_expected_for_professor" -gt 0 ]; then
+            local pdfs_done=$(wc -l < "$TEMP_DIR/.progress_count" 2>/dev/null || echo 0)
+            echo "PROGRESS: $((pdfs_done * 90 / total_pdfs_expected_for_professor))"
         fi
+        sleep 0.5
+    done
+    wait "$pid"
+done
+total_pdfs_processed_for_professor=$((next_doc_id - 1))
 
-    # Add this RIGHT BEFORE including the PDF
-    echo "\\newpage" >> "$TEMP_DIR/metadata.tex"
-    echo "\\hypertarget{startdoc$total_pdfs_processed_for_professor}{}" >> "$TEMP_DIR/metadata.tex"
-
-    # Then include the PDF
-    echo "\\includepdf[pages=-,pagecommand={\\thispagestyle{fancy}}]{$SAFE_NAME}" >> "$TEMP_DIR/metadata.tex"
-
-        log "Processado: $pdf → $SAFE_NAME (Número: $doc_num)"
+# Record the input fingerprints so the next run can skip clean categories
+: > "$MANIFEST_FILE"
+pasta_index=0
+for pasta in "${pastas[@]}"; do
+    if [ -n "${category_fps[$pasta_index]:-}" ]; then
+        printf '%s\t%s\n' "$pasta_index" "${category_fps[$pasta_index]}" >> "$MANIFEST_FILE"
+    fi
+    ((pasta_index++))
+done
 
-        # --- PROGRESS REPORTING DURING PDF PROCESSING ---
-        if [ "$total_pdfs_expected_for_professor" -gt 0 ]; then
-            local current_percentage=$((total_pdfs_processed_for_professor * 90 / total_pdfs_expected_for_professor))
-            echo "PROGRESS: $current_percentage"
-        fi
-        # --- END PROGRESS REPORTING ---
-    done
+# Concatenate fragments in category order (completion order is irrelevant)
+pasta_index=0
+for pasta in "${pastas[@]}"; do
+    local FRAG
+    printf -v FRAG "%s/section_%03d.tex" "$TEMP_DIR" "$pasta_index"
+    if [ -f "$FRAG" ]; then
+        cat "$FRAG" >> "$TEMP_DIR/metadata.tex"
+    fi
+    ((pasta_index++))
 done
 
 
@@ -448,20 +628,34 @@ log "Compiling PDF professional..."
 # 7. Finalizar
 if [ -f "$TEMP_DIR/metadata.pdf" ]; then
     mkdir -p "final"
-    gs -q -dNOPAUSE -dBATCH -sDEVICE=pdfwrite -dCompatibilityLevel=1.7 \
-       -dPDFSETTINGS=/prepress -sOutputFile="final/$OUTPUT" "$TEMP_DIR/metadata.pdf"
+    # Single streaming pass over the compiled document: qpdf reads each
+    # object exactly once and writes the linearized final file. gs does a
+    # full re-interpretation of every page, so it stays only as the
+    # fallback where qpdf is not installed (or rejects the input).
+    if command -v qpdf >/dev/null 2>&1 && \
+       qpdf --linearize "$TEMP_DIR/metadata.pdf" "final/$OUTPUT" 2>/dev/null; then
+        log "Arquivo final montado em passagem única (qpdf)."
+    else
+        log "qpdf indisponível ou falhou; finalizando com gs."
+        gs -q -dNOPAUSE -dBATCH -sDEVICE=pdfwrite -dCompatibilityLevel=1.7 \
+           -dPDFSETTINGS=/prepress -sOutputFile="final/$OUTPUT" "$TEMP_DIR/metadata.pdf"
+    fi
 
     log "SUCESSO: PDF ABNT gerado com capa institucional"
     log "Arquivo final: final/$OUTPUT"
     echo "PROGRESS: 100"
 
-    # Safely remove the temporary directory and its contents
-    log "Cleaning up temporary directory: $TEMP_DIR"
-    rm -rf "$TEMP_DIR"
+    # Keep doc_*.pdf, section_*.tex and the manifest so the next run can
+    # reuse unchanged categories; drop only the compile intermediates
+    log "Cleaning up compile intermediates in: $TEMP_DIR"
+    rm -f "$TEMP_DIR"/metadata.tex "$TEMP_DIR"/metadata.pdf \
+          "$TEMP_DIR"/metadata.aux "$TEMP_DIR"/metadata.log \
+          "$TEMP_DIR"/metadata.toc "$TEMP_DIR"/metadata.out \
+          "$TEMP_DIR"/compile.log "$TEMP_DIR"/.progress_count
     if [ $? -eq 0 ]; then
-        log "Temporary directory removed successfully."
+        log "Compile intermediates removed successfully."
     else
-        log "\033[31mWARNING: Failed to remove temporary directory '$TEMP_DIR'. Manual cleanup may be required.\033[0m"
+        log "\033[31mWARNING: Failed to clean '$TEMP_DIR'. Manual cleanup may be required.\033[0m"
     fi
 
 else
@@ -20,13 +20,22 @@
 #include <string.h>
 #include <stdio.h>
 #include <errno.h>
-#include <dirent.h>
 #include <sys/stat.h>
 #include <locale.h>
 #include <stdlib.h>
 #include <sys/wait.h>
+#include <time.h>
+#include <stdarg.h>
 #include <limits.h>
 #include <unistd.h>
+#include <fcntl.h>
+#ifdef __linux__
+#include <sys/ioctl.h>
+#include <linux/fs.h>
+#endif
+#ifdef HAVE_POPPLER
+#include <poppler.h>
+#endif
 
 // =============================================================================
 // STRUCTURE DEFINITIONS
@@ -39,13 +48,23 @@ typedef struct {
     GtkWidget *frame;
     GtkWidget *list;
     GtkWidget *add_btn;
-    GList *entries;
+    GtkWidget *open_folder_btn;
+    GPtrArray *entries;          /* PdfEntry*, O(1) append/length */
+    GPtrArray *unmaterialized;   /* PdfEntry* still awaiting row creation */
+    GtkAdjustment *vadjustment;  /* of this section's scrolled window */
 } CategorySection;
 
 /**
- * @brief Holds info for each PDF entry (row) in the GUI.
+ * @brief Data model for one PDF document, plus its (optional) GUI row.
+ *
+ * The *_text fields are authoritative while no row exists; widgets are only
+ * materialized for entries the user actually scrolls to, so memory and
+ * widget-construction time scale with what is viewed, not with archive size.
+ * Use the pdf_entry_get_*/pdf_entry_set_* accessors, which read or update
+ * whichever backing store is live.
  */
 typedef struct {
+    GtkListBoxRow *row;          /* NULL until materialized */
     GtkWidget *box;
     GtkWidget *file_btn;
     GtkWidget *counter_entry;
@@ -54,7 +73,14 @@ typedef struct {
     GtkWidget *category_entry;
     GtkWidget *remove_btn;
     GtkWidget *preview_btn;
+    gchar *title_text;
+    gchar *year_text;
+    gchar *category_text;
+    gchar *counter_text;
+    gint category_index;         /* section this entry belongs to */
     gchar *file_path;
+    gint64 file_size;            /* bytes, 0 until known; feeds category stats */
+    gint page_count;             /* from exiftool PageCount, 0 until known */
     gchar *original_title;
     gchar *original_year;
     gchar *original_category;
@@ -69,13 +95,137 @@ typedef struct {
  */
 typedef struct {
     gchar *file_path;
-    GtkListBoxRow *gui_row;
+    PdfEntry *entry;
+    guint generation;       /* pdf_load_generation at queue time; stale ops are dropped */
     gint category_index;
     gboolean is_new_file_selection;
-    gint stdout_fd;
-    gint stderr_fd;
+    gint64 file_mtime;      /* captured during the folder scan, 0 if unknown */
+    gint64 file_size;
+    gboolean from_cache;    /* metadata came from the sidecar cache, don't re-store */
 } ExiftoolReadOperation;
 
+/**
+ * @brief One record of the per-folder sidecar metadata cache.
+ *
+ * The cache lets "Recarregar Professor" skip exiftool entirely for files
+ * whose (mtime, size) have not changed since the metadata was last read.
+ */
+typedef struct {
+    gint64 mtime;
+    gint64 size;
+    gchar *title;
+    gchar *year;
+    gchar *category;
+    gint page_count;    /* 0 when the cache predates page counting */
+} MetadataCacheEntry;
+
+#define METADATA_CACHE_FILENAME ".metadata_cache"
+
+// The backend report generator shipped alongside this GUI. Single source
+// of truth for the launcher, headless mode and the preflight check.
+#define BACKEND_SCRIPT_PATH "./generate_pdf_professor_v2.0.2-R22.sh"
+
+/**
+ * @brief Widget-free copy of one PdfEntry, as held by a session snapshot.
+ */
+typedef struct {
+    gchar *file_path;
+    gint64 file_size;
+    gint page_count;
+    gchar *title;
+    gchar *year;
+    gchar *category;
+    gchar *counter;
+    gchar *original_title;
+    gchar *original_year;
+    gchar *original_category;
+    gchar *original_filename_no_ext;
+    gboolean has_original_counter;
+    gint original_detected_counter;
+    gint current_counter_value;
+} SnapshotEntry;
+
+/**
+ * @brief Everything needed to rebuild a professor's GUI without rescanning.
+ *
+ * Captured when the user switches away from a professor; validated against
+ * the per-category directory mtimes before being replayed, so stale
+ * snapshots fall back to the normal folder scan.
+ */
+typedef struct {
+    gint num_categories;
+    gint64 *dir_mtimes;      /* one per category, 0 if the folder was absent */
+    GPtrArray **entries;     /* one SnapshotEntry* array per category */
+    gint *max_counters;      /* global_max_category_counters at capture time */
+} ProfessorSnapshot;
+
+/**
+ * @brief State for the persistent exiftool worker process (-stay_open mode).
+ *
+ * One exiftool process is started at application startup and kept alive for
+ * the whole session. Metadata read requests are written to its stdin using
+ * the -@ argfile protocol and answered in FIFO order, so each read costs a
+ * single pipe round-trip instead of a full Perl interpreter startup.
+ */
+typedef struct {
+    GPid pid;
+    gint stdin_fd;
+    gint stdout_fd;
+    GIOChannel *stdout_channel;
+    guint stdout_watch_id;
+    GString *read_buffer;
+    GQueue *pending_ops;   /* ExiftoolReadOperation*, FIFO, matches -execute order */
+    gboolean running;
+} ExiftoolDaemon;
+
+typedef struct SaveBatch SaveBatch;
+
+/**
+ * @brief Called on the main thread once every job of a save batch finished.
+ */
+typedef void (*SaveBatchCallback)(SaveBatch *batch);
+
+/**
+ * @brief Tracks one batch of save jobs running on the worker pool.
+ *
+ * completed/failed are only touched from main-thread idle callbacks, so no
+ * atomics are needed; workers hand their result back via g_idle_add.
+ */
+struct SaveBatch {
+    gint total;
+    gint completed;
+    gint failed;
+    gchar *professor;
+    gdouble progress_base;   /* progress bar range occupied by this batch */
+    gdouble progress_span;
+    GPtrArray *jobs;         /* SaveJob*, kept alive for the batched metadata write */
+    gchar *argfile_path;     /* temp exiftool argfile, deleted after the write */
+    gint journal_metadata_op; /* journal id of the batched metadata write */
+    SaveBatchCallback on_complete;
+};
+
+/**
+ * @brief One fully-resolved save work item, safe to execute off-thread.
+ *
+ * All GTK widget reads, counter assignment and path construction happen on
+ * the main thread in prepare_save_job(); the worker only copies the file
+ * and archives the original. Metadata is written afterwards in a single
+ * batched exiftool pass over the whole batch.
+ */
+typedef struct {
+    SaveBatch *batch;
+    gchar *src_path;
+    gchar *dest_category_dir;
+    gchar *dest_file_name;
+    gchar *dest_file_path;
+    gchar *title;
+    gchar *year;
+    gchar *category;
+    gint page_count;            /* carried from the entry for the cache record */
+    gboolean archive_original;  /* filename changed, move source to old_files */
+    gboolean success;
+} SaveJob;
+
 
 // =============================================================================
 // GLOBAL VARIABLES
@@ -93,42 +243,99 @@ GtkWidget *categories_text_view = NULL;
 GtkWidget *progress_bar = NULL;
 GtkWidget *status_label = NULL;
 GtkWidget *preview_report_btn = NULL;
+gboolean category_gui_built = FALSE;  /* sections are constructed lazily */
 GtkWidget *save_all_btn = NULL;
 gint *global_max_category_counters = NULL;
+gint64 *global_category_total_bytes = NULL;   /* per-category byte sums for live stats */
+ExiftoolDaemon exiftool_daemon = { 0 };
+guint pdf_load_generation = 0;  /* bumped whenever the entry lists are cleared */
+gint pdf_loads_outstanding = 0; /* metadata reads queued but not yet applied */
+gint pdf_loads_total = 0;       /* reads queued since the last professor load */
 
 // =============================================================================
 // FORWARD DECLARATIONS
 // =============================================================================
 
-void exiftool_read_completed_callback(GPid pid, gint status, gpointer user_data);
+void exiftool_apply_metadata(ExiftoolReadOperation *op, const gchar *json_buf, gboolean exiftool_ok, const gchar *error_text);
+void pdf_entry_populate_metadata(ExiftoolReadOperation *op, const gchar *title, const gchar *year, const gchar *category, gint page_count);
+gchar* session_strdup(const gchar *text);
+gchar* session_intern(const gchar *text);
+void session_arena_reset(void);
+void pdf_load_track_queued(void);
+void pdf_load_track_finished(guint generation);
+void pdf_load_completed_ui(void);
+void professor_snapshot_store(const gchar *professor);
+gboolean professor_snapshot_restore(const gchar *professor);
+void professor_snapshot_drop(const gchar *professor);
+void professor_snapshots_clear(void);
+GHashTable* metadata_cache_load(const gchar *folder_path);
+void metadata_cache_append(const gchar *folder_path, const gchar *file_basename, gint64 mtime, gint64 size,
+                           const gchar *title, const gchar *year, const gchar *category, gint page_count);
+gboolean exiftool_daemon_start(void);
+void exiftool_daemon_shutdown(void);
+gboolean exiftool_daemon_submit(ExiftoolReadOperation *op);
+gboolean spawn_exiftool_read(ExiftoolReadOperation *op);
+gboolean exiftool_batch_read(GPtrArray *ops);
 void on_file_set(GtkFileChooserButton *button, GtkListBoxRow *row);
 void on_category_entry_changed(GtkEditable *editable, PdfEntry *entry);
+void list_box_schedule_sort(GtkListBox *list_box);
 void on_counter_entry_changed(GtkEditable *editable, PdfEntry *entry);
 gboolean on_professor_selected(GtkComboBox *combo_box, gpointer user_data);
 void on_remove_pdf_entry(GtkWidget *button, PdfEntry *entry);
-void add_pdf_entry(GtkWidget *widget, CategorySection *section);
+void file_move_queue_submit(const gchar *src_path, const gchar *dest_path, const gchar *description);
+void add_pdf_entry(GtkWidget *widget, gpointer user_data);
 void on_preview_pdf(GtkWidget *button, PdfEntry *entry);
 void on_preview_report_pdf(GtkWidget *button, gpointer user_data);
 void on_save_all_entries(GtkWidget *button, gpointer user_data);
 void on_report_generation_finished(GPid pid, gint status, gpointer user_data);
-void on_open_category_folder(GtkWidget *button, gint category_index);
+void on_open_category_folder(GtkWidget *button, gpointer user_data);
 void on_reload_professor_button_clicked(GtkWidget *button, gpointer user_data);
 void on_category_shortcut_clicked(GtkWidget *button, gpointer user_data);
 void on_create_professor_folder_clicked(GtkWidget *button, gpointer user_data);
 
 gboolean load_categories_from_file(const gchar *filepath);
+gint headless_main(const gchar *target);
 gboolean load_professors_from_file(const gchar *filepath);
 void cleanup_category_gui();
 void create_category_gui(GtkWidget *nav_list_box, GtkWidget *content_vbox);
+void ensure_category_gui(void);
 void refresh_category_gui();
 void refresh_professor_combo();
 gchar* sanitize_filename(const gchar *input);
 PdfEntry* create_pdf_entry();
+const gchar* pdf_entry_get_title(PdfEntry *entry);
+const gchar* pdf_entry_get_year(PdfEntry *entry);
+const gchar* pdf_entry_get_category(PdfEntry *entry);
+const gchar* pdf_entry_get_counter(PdfEntry *entry);
+void pdf_entry_set_title(PdfEntry *entry, const gchar *text);
+void pdf_entry_set_year(PdfEntry *entry, const gchar *text);
+void pdf_entry_set_category(PdfEntry *entry, const gchar *text);
+void pdf_entry_set_counter(PdfEntry *entry, const gchar *text);
 GtkListBoxRow* create_pdf_entry_row(PdfEntry *entry, gint category_index);
 void add_pdf_entry_to_gui(gint category_index, PdfEntry *entry, GtkListBoxRow *row);
-gboolean save_single_pdf_entry(PdfEntry *entry, const gchar *professor_name, gint category_index);
+void category_stats_update_label(gint category_index);
+void category_stats_entry_added(gint category_index, PdfEntry *entry);
+void category_stats_entry_removed(gint category_index, PdfEntry *entry);
+void category_stats_reset(void);
+void export_category_statistics(GtkWidget *button, gpointer user_data);
+void category_section_materialize_rows(gint category_index, guint max_rows);
+void category_monitors_start(const gchar *professor);
+void category_monitors_stop(void);
+void category_monitors_note_self_write(const gchar *path);
+SaveJob* prepare_save_job(PdfEntry *entry, const gchar *professor_name, gint category_index, SaveBatch *batch);
+gint save_all_entries_async(const gchar *professor_name, gdouble progress_base, gdouble progress_span,
+                            SaveBatchCallback on_complete);
+void save_journal_open(const gchar *professor, gint total_jobs);
+gint save_journal_intent(const gchar *op, const gchar *src, const gchar *dest);
+void save_journal_done(gint id);
+void save_journal_close(void);
+void save_journal_recover(void);
+void launch_report_backend(const gchar *professor);
 void generate_report(GtkWidget *widget, gpointer data);
 void process_pdf_folder(const gchar *folder_path, gint category_index);
+gboolean filename_has_pdf_suffix(const gchar *name);
+void trace_init(void);
+void trace_dump_summary(void);
 
 void save_professors_list(GtkWidget *button, gpointer user_data);
 void save_categories_list(GtkWidget *button, gpointer user_data);
@@ -163,1577 +370,4640 @@ gboolean is_valid_path(const gchar *path) {
 }
 
 /**
- * @brief Callback for exiftool completion. Updates GUI with metadata.
+ * @brief Case-insensitive ".pdf" suffix test that allocates nothing.
  */
-void exiftool_read_completed_callback(GPid pid, gint status, gpointer user_data) {
-    ExiftoolReadOperation *op = (ExiftoolReadOperation *)user_data;
-    if (!op) return;
+gboolean filename_has_pdf_suffix(const gchar *name) {
+    gsize len = name ? strlen(name) : 0;
+    if (len < 4) return FALSE;
+
+    const gchar *ext = name + len - 4;
+    return ext[0] == '.' &&
+           g_ascii_tolower(ext[1]) == 'p' &&
+           g_ascii_tolower(ext[2]) == 'd' &&
+           g_ascii_tolower(ext[3]) == 'f';
+}
 
-    g_print("[Main Thread] Exiftool process (PID: %d) finished with status: %d\n", pid, status);
+// =============================================================================
+// NON-BLOCKING EXIFTOOL PIPE DRAINING
+// =============================================================================
 
-    g_spawn_close_pid(pid);
+typedef struct ExiftoolSpawnWatch ExiftoolSpawnWatch;
+
+/**
+ * @brief Incremental drain state for one pipe of a spawned process.
+ */
+typedef struct {
+    GIOChannel *channel;
+    guint watch_id;
+    GString *data;
+    gboolean eof;
+    ExiftoolSpawnWatch *owner;
+} PipeDrain;
+
+/**
+ * @brief Fired once the child exited and both pipes reached EOF.
+ */
+typedef void (*ExiftoolDrainDoneFunc)(gint status, const gchar *stdout_buf, const gchar *stderr_buf, gpointer user_data);
+
+/**
+ * @brief Couples a child watch with async drains of its stdout/stderr.
+ *
+ * The pipes are read incrementally from G_IO_IN watches as data arrives, so
+ * a child writing more than the pipe capacity (64KB) never blocks on us and
+ * the main thread never performs a blocking read after exit.
+ */
+struct ExiftoolSpawnWatch {
+    PipeDrain out;
+    PipeDrain err;
+    gint child_status;
+    gboolean child_exited;
+    ExiftoolDrainDoneFunc on_done;
+    gpointer user_data;
+};
+
+/**
+ * @brief Completes the watch when the child exited and both drains hit EOF.
+ */
+static void exiftool_spawn_watch_maybe_finish(ExiftoolSpawnWatch *watch) {
+    if (!watch->child_exited || !watch->out.eof || !watch->err.eof) return;
+
+    gchar *stdout_buf = g_string_free(watch->out.data, FALSE);
+    gchar *stderr_buf = g_string_free(watch->err.data, FALSE);
+    g_io_channel_unref(watch->out.channel);
+    g_io_channel_unref(watch->err.channel);
+
+    watch->on_done(watch->child_status, stdout_buf, stderr_buf, watch->user_data);
+
+    SAFE_FREE(stdout_buf);
+    SAFE_FREE(stderr_buf);
+    g_free(watch);
+}
+
+/**
+ * @brief IO watch callback: drains whatever is currently readable.
+ */
+static gboolean pipe_drain_ready(GIOChannel *source, GIOCondition condition, gpointer user_data) {
+    PipeDrain *drain = (PipeDrain *)user_data;
+    (void)condition;
 
-    gchar *stdout_buf = NULL;
-    gchar *stderr_buf = NULL;
-    gsize bytes_read;
     gchar buffer[4096];
+    gsize bytes_read = 0;
+    GIOStatus io_status;
 
-    GString *stdout_gstring = g_string_new("");
-    GString *stderr_gstring = g_string_new("");
+    do {
+        io_status = g_io_channel_read_chars(source, buffer, sizeof(buffer), &bytes_read, NULL);
+        if (bytes_read > 0) {
+            g_string_append_len(drain->data, buffer, bytes_read);
+        }
+    } while (io_status == G_IO_STATUS_NORMAL && bytes_read > 0);
 
-    while ((bytes_read = read(op->stdout_fd, buffer, sizeof(buffer) - 1)) > 0) {
-        buffer[bytes_read] = '\0';
-        g_string_append(stdout_gstring, buffer);
+    if (io_status == G_IO_STATUS_EOF || io_status == G_IO_STATUS_ERROR) {
+        drain->eof = TRUE;
+        drain->watch_id = 0;
+        exiftool_spawn_watch_maybe_finish(drain->owner);
+        return G_SOURCE_REMOVE;
     }
-    stdout_buf = g_string_free(stdout_gstring, FALSE);
 
-    while ((bytes_read = read(op->stderr_fd, buffer, sizeof(buffer) - 1)) > 0) {
-        buffer[bytes_read] = '\0';
-        g_string_append(stderr_gstring, buffer);
-    }
-    stderr_buf = g_string_free(stderr_gstring, FALSE);
+    return G_SOURCE_CONTINUE;
+}
 
-    close(op->stdout_fd);
-    close(op->stderr_fd);
+static void pipe_drain_setup(PipeDrain *drain, gint fd, ExiftoolSpawnWatch *owner) {
+    drain->owner = owner;
+    drain->data = g_string_new("");
+    drain->eof = FALSE;
+    drain->channel = g_io_channel_unix_new(fd);
+    g_io_channel_set_encoding(drain->channel, NULL, NULL);
+    g_io_channel_set_buffered(drain->channel, FALSE);
+    g_io_channel_set_flags(drain->channel, G_IO_FLAG_NONBLOCK, NULL);
+    g_io_channel_set_close_on_unref(drain->channel, TRUE);
+    drain->watch_id = g_io_add_watch(drain->channel, G_IO_IN | G_IO_HUP | G_IO_ERR, pipe_drain_ready, drain);
+}
 
-    PdfEntry *entry = g_object_get_data(G_OBJECT(op->gui_row), "pdf-entry");
+static void exiftool_spawn_watch_child_exited(GPid pid, gint status, gpointer user_data) {
+    ExiftoolSpawnWatch *watch = (ExiftoolSpawnWatch *)user_data;
 
-    if (!entry) {
-        g_warning("PdfEntry already freed or GUI row invalid in exiftool_read_completed_callback. Skipping GUI update.");
-        SAFE_FREE(stdout_buf);
-        SAFE_FREE(stderr_buf);
-        SAFE_FREE(op->file_path);
-        SAFE_FREE(op);
-        return;
-    }
+    g_print("[Main Thread] Exiftool process (PID: %d) finished with status: %d\n", pid, status);
+    g_spawn_close_pid(pid);
 
-    g_print("[Main Thread] Updating GUI for %s\n", op->file_path);
+    watch->child_status = status;
+    watch->child_exited = TRUE;
+    exiftool_spawn_watch_maybe_finish(watch);
+}
 
-    gchar *extracted_title_local = NULL;
-    gchar *extracted_year_local = NULL;
-    gchar *extracted_category_local = NULL;
-    gchar *original_filename_no_ext_local = NULL;
+/**
+ * @brief Attaches drain watches and a child watch to a freshly spawned pid.
+ */
+static void exiftool_spawn_watch_new(GPid pid, gint stdout_fd, gint stderr_fd,
+                                     ExiftoolDrainDoneFunc on_done, gpointer user_data) {
+    ExiftoolSpawnWatch *watch = g_new0(ExiftoolSpawnWatch, 1);
+    watch->on_done = on_done;
+    watch->user_data = user_data;
+    pipe_drain_setup(&watch->out, stdout_fd, watch);
+    pipe_drain_setup(&watch->err, stderr_fd, watch);
+    g_child_watch_add(pid, exiftool_spawn_watch_child_exited, watch);
+}
 
-    gchar *basename = g_path_get_basename(op->file_path);
-    gchar *basename_copy = g_strdup(basename);
-    gchar *filename_no_ext_ptr = g_strrstr(basename_copy, ".");
-    if (filename_no_ext_ptr) {
-        *filename_no_ext_ptr = '\0';
-    }
-    original_filename_no_ext_local = g_strdup(basename_copy);
+/**
+ * @brief Drain-done callback for a single-file exiftool read.
+ */
+static void exiftool_read_drained(gint status, const gchar *stdout_buf, const gchar *stderr_buf, gpointer user_data) {
+    ExiftoolReadOperation *op = (ExiftoolReadOperation *)user_data;
+    if (!op) return;
 
-    if (strlen(basename_copy) >= 3 && g_ascii_isdigit(basename_copy[0]) &&
-        g_ascii_isdigit(basename_copy[1]) && basename_copy[2] == '_') {
-        gchar counter_str[3];
-        counter_str[0] = basename_copy[0];
-        counter_str[1] = basename_copy[1];
-        counter_str[2] = '\0';
-        gint counter_val = atoi(counter_str);
+    gboolean exiftool_ok = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    exiftool_apply_metadata(op, stdout_buf, exiftool_ok, stderr_buf);
+}
 
-        if (counter_val > 0) {
-            entry->has_original_counter = TRUE;
-            entry->original_detected_counter = counter_val;
-            extracted_title_local = g_strdup(basename_copy + 3);
-        }
-    }
-    if (!extracted_title_local) {
-        extracted_title_local = g_strdup(basename_copy);
-    }
-    SAFE_FREE(basename_copy);
-    SAFE_FREE(basename);
+// =============================================================================
+// PERFORMANCE INSTRUMENTATION
+// =============================================================================
 
-    if (WIFEXITED(status) && WEXITSTATUS(status) == 0 && stdout_buf) {
-        g_print("  [Main Thread] Exiftool JSON raw output: %s\n", stdout_buf);
-
-        gchar *json_str = stdout_buf;
-        gboolean title_found_by_exiftool = FALSE;
-        gboolean year_found_by_exiftool = FALSE;
-        gboolean category_found_by_exiftool = FALSE;
-
-        gchar *title_key = g_strstr_len(json_str, -1, "\"Title\":");
-        if (title_key) {
-            title_key += strlen("\"Title\":");
-            gchar *title_start = strchr(title_key, '"');
-            if (title_start) {
-                title_start++;
-                gchar *title_end = strchr(title_start, '"');
-                if (title_end) {
-                    SAFE_FREE(extracted_title_local);
-                    extracted_title_local = g_strndup(title_start, title_end - title_start);
-                    title_found_by_exiftool = TRUE;
-                }
-            }
-        }
+// Per-subsystem trace categories. Enabled via the REPORT_GUI_TRACE
+// environment variable: "all", or a comma-separated subset of the names in
+// trace_category_names[]. Disabled (the default) costs one integer test per
+// trace point.
+typedef enum {
+    TRACE_SCAN = 0,
+    TRACE_METADATA_READ,
+    TRACE_METADATA_WRITE,
+    TRACE_COPY,
+    TRACE_REPORT,
+    TRACE_NUM_CATEGORIES
+} TraceCategory;
+
+typedef enum {
+    TRACE_COUNT_FILES_SCANNED = 0,
+    TRACE_COUNT_CACHE_HITS,
+    TRACE_COUNT_PROCESSES_SPAWNED,
+    TRACE_COUNT_BYTES_COPIED,
+    TRACE_NUM_COUNTERS
+} TraceCounter;
+
+static const gchar *trace_category_names[TRACE_NUM_CATEGORIES] = {
+    "scan", "metadata-read", "metadata-write", "copy", "report"
+};
+
+static const gchar *trace_counter_names[TRACE_NUM_COUNTERS] = {
+    "files scanned", "cache hits", "processes spawned", "bytes copied"
+};
+
+guint trace_flags = 0;                 // bitmask of enabled categories
+static gint64 trace_elapsed_ns[TRACE_NUM_CATEGORIES];
+static gint64 trace_events[TRACE_NUM_CATEGORIES];
+static gint64 trace_counters[TRACE_NUM_COUNTERS];
+static GMutex trace_lock;              // save workers update counters too
+
+#define TRACE_ENABLED(cat) ((trace_flags & (1u << (cat))) != 0)
 
-        gchar *year_key = g_strstr_len(json_str, -1, "\"Year\":");
-        if (year_key) {
-            year_key += strlen("\"Year\":");
-            gchar *year_start = strchr(year_key, '"');
-            if (year_start) {
-                year_start++;
-                gchar *year_end = strchr(year_start, '"');
-                if (year_end) {
-                    extracted_year_local = g_strndup(year_start, year_end - year_start);
-                    year_found_by_exiftool = TRUE;
-                }
-            }
-        }
+/**
+ * @brief Monotonic timestamp in nanoseconds.
+ */
+gint64 trace_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (gint64)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
 
-        gchar *category_key = g_strstr_len(json_str, -1, "\"Category\":");
-        if (category_key) {
-            category_key += strlen("\"Category\":");
-            gchar *category_start = strchr(category_key, '"');
-            if (category_start) {
-                category_start++;
-                gchar *category_end = strchr(category_start, '"');
-                if (category_end) {
-                    extracted_category_local = g_strndup(category_start, category_end - category_start);
-                    category_found_by_exiftool = TRUE;
-                }
-            }
-        }
+// Timing pair: TRACE_BEGIN evaluates to 0 when the category is off, so the
+// disabled path never touches the clock.
+#define TRACE_BEGIN(cat) (TRACE_ENABLED(cat) ? trace_now_ns() : 0)
+#define TRACE_END(cat, start_ns) do { \
+    if ((start_ns) != 0) trace_span_end((cat), (start_ns)); \
+} while (0)
 
-        if (title_found_by_exiftool) {
-            g_print("  [Main Thread] Exiftool found title: \"%s\"\n", extracted_title_local);
-        } else {
-            g_print("  [Main Thread] Exiftool did NOT find a title. Using filename-derived title: \"%s\"\n", extracted_title_local);
-        }
-        if (year_found_by_exiftool) {
-            g_print("  [Main Thread] Exiftool found year: \"%s\"\n", extracted_year_local);
-        } else {
-            g_print("  [Main Thread] Exiftool did NOT find a year. Using filename-derived year (if any): \"%s\"\n", extracted_year_local ? extracted_year_local : "(null)");
-        }
-        if (category_found_by_exiftool) {
-            g_print("  [Main Thread] Exiftool found category: \"%s\"\n", extracted_category_local);
-        } else {
-            g_print("  [Main Thread] Exiftool did NOT find a category.\n");
-        }
-    } else {
-        g_warning("  [Main Thread] Exiftool command failed for %s. Exit status: %d. Stderr: %s",
-                  op->file_path, WEXITSTATUS(status), stderr_buf ? stderr_buf : "(empty)");
-    }
+/**
+ * @brief Accumulates one timed span into a category.
+ */
+void trace_span_end(TraceCategory cat, gint64 start_ns) {
+    gint64 elapsed = trace_now_ns() - start_ns;
+    g_mutex_lock(&trace_lock);
+    trace_elapsed_ns[cat] += elapsed;
+    trace_events[cat]++;
+    g_mutex_unlock(&trace_lock);
+}
 
-    if (!extracted_year_local) {
-        gchar *temp_filename_for_year_parsing = g_path_get_basename(op->file_path);
-        gchar *filename_no_ext_temp = g_strrstr(temp_filename_for_year_parsing, ".");
-        if (filename_no_ext_temp) {
-            *filename_no_ext_temp = '\0';
-        }
-        gchar *last_underscore = g_strrstr(temp_filename_for_year_parsing, "_");
-        if (last_underscore && strlen(last_underscore + 1) == 4) {
-            gboolean is_numeric = TRUE;
-            for (gint k = 0; k < 4; k++) {
-                if (!g_ascii_isdigit(last_underscore[1 + k])) {
-                    is_numeric = FALSE;
-                    break;
+/**
+ * @brief Adds to a named counter (thread-safe; no-op when tracing is off).
+ */
+void trace_count(TraceCounter counter, gint64 delta) {
+    if (trace_flags == 0) return;
+    g_mutex_lock(&trace_lock);
+    trace_counters[counter] += delta;
+    g_mutex_unlock(&trace_lock);
+}
+
+/**
+ * @brief Gated replacement for hot-path g_print: only emits when the
+ * category is enabled, so large scans no longer serialize on stdout.
+ */
+void trace_log(TraceCategory cat, const gchar *format, ...) {
+    if (!TRACE_ENABLED(cat)) return;
+    va_list args;
+    va_start(args, format);
+    gchar *message = g_strdup_vprintf(format, args);
+    va_end(args);
+    g_print("[trace:%s +%" G_GINT64_FORMAT "ns] %s\n",
+            trace_category_names[cat], trace_now_ns(), message);
+    SAFE_FREE(message);
+}
+
+/**
+ * @brief Parses REPORT_GUI_TRACE and arms the requested categories.
+ */
+void trace_init(void) {
+    static gboolean initialized = FALSE;
+    if (initialized) return;
+    initialized = TRUE;
+
+    const gchar *spec = g_getenv("REPORT_GUI_TRACE");
+    if (!spec || *spec == '\0') return;
+
+    if (g_strcmp0(spec, "all") == 0 || g_strcmp0(spec, "1") == 0) {
+        trace_flags = (1u << TRACE_NUM_CATEGORIES) - 1;
+    } else {
+        gchar **parts = g_strsplit(spec, ",", -1);
+        for (gint i = 0; parts[i] != NULL; i++) {
+            const gchar *name = g_strstrip(parts[i]);
+            for (gint cat = 0; cat < TRACE_NUM_CATEGORIES; cat++) {
+                if (g_strcmp0(name, trace_category_names[cat]) == 0) {
+                    trace_flags |= (1u << cat);
                 }
             }
-            if (is_numeric) {
-                extracted_year_local = g_strdup(last_underscore + 1);
-            }
         }
-        SAFE_FREE(temp_filename_for_year_parsing);
+        g_strfreev(parts);
     }
 
-    if (!extracted_category_local && op->category_index >= 0 && op->category_index < global_num_categories) {
-        extracted_category_local = g_strdup(global_categories[op->category_index]);
-    } else if (!extracted_category_local) {
-        extracted_category_local = g_strdup("documento");
+    if (trace_flags != 0) {
+        g_print("Tracing enabled (REPORT_GUI_TRACE=%s).\n", spec);
+    }
+}
+
+/**
+ * @brief Prints the accumulated timing/counter summary (called on exit).
+ */
+void trace_dump_summary(void) {
+    if (trace_flags == 0) return;
+
+    g_print("\n===== trace summary =====\n");
+    g_print("%-16s %10s %14s %14s\n", "category", "events", "total ms", "avg us");
+    for (gint cat = 0; cat < TRACE_NUM_CATEGORIES; cat++) {
+        if (!TRACE_ENABLED(cat) || trace_events[cat] == 0) continue;
+        g_print("%-16s %10" G_GINT64_FORMAT " %14.2f %14.2f\n",
+                trace_category_names[cat],
+                trace_events[cat],
+                trace_elapsed_ns[cat] / 1e6,
+                trace_elapsed_ns[cat] / 1e3 / trace_events[cat]);
+    }
+    for (gint c = 0; c < TRACE_NUM_COUNTERS; c++) {
+        if (trace_counters[c] == 0) continue;
+        g_print("%-32s %14" G_GINT64_FORMAT "\n",
+                trace_counter_names[c], trace_counters[c]);
     }
+    g_print("=========================\n");
+}
 
-    gtk_entry_set_text(GTK_ENTRY(entry->title_entry), extracted_title_local ? extracted_title_local : "Título Não Informado");
-    gtk_entry_set_text(GTK_ENTRY(entry->year_entry), extracted_year_local ? extracted_year_local : "");
-    gtk_entry_set_text(GTK_ENTRY(entry->category_entry), extracted_category_local);
+// =============================================================================
+// SINGLE-PASS JSON PARSER FOR EXIFTOOL OUTPUT
+// =============================================================================
 
-    SAFE_FREE(entry->original_title);
-    entry->original_title = g_strdup(extracted_title_local ? extracted_title_local : "Título Não Informado");
-    SAFE_FREE(entry->original_year);
-    entry->original_year = g_strdup(extracted_year_local ? extracted_year_local : "");
-    SAFE_FREE(entry->original_category);
-    entry->original_category = g_strdup(extracted_category_local);
-    SAFE_FREE(entry->original_filename_no_ext);
-    entry->original_filename_no_ext = original_filename_no_ext_local;
-    entry->current_counter_value = entry->original_detected_counter;
+/**
+ * @brief One object of an 'exiftool -j' JSON array, reduced to our tags.
+ */
+typedef struct {
+    gchar *source_file;
+    gchar *title;
+    gchar *year;
+    gchar *category;
+    gchar *page_count;
+} ExiftoolJsonRecord;
+
+static void exiftool_json_record_free(gpointer data) {
+    ExiftoolJsonRecord *rec = (ExiftoolJsonRecord *)data;
+    if (!rec) return;
+    SAFE_FREE(rec->source_file);
+    SAFE_FREE(rec->title);
+    SAFE_FREE(rec->year);
+    SAFE_FREE(rec->category);
+    SAFE_FREE(rec->page_count);
+    g_free(rec);
+}
 
-    if (!op->is_new_file_selection && entry->original_detected_counter > 0) {
-        if (entry->original_detected_counter > global_max_category_counters[op->category_index]) {
-            global_max_category_counters[op->category_index] = entry->original_detected_counter;
+static const gchar* json_skip_ws(const gchar *p) {
+    while (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r') p++;
+    return p;
+}
+
+/**
+ * @brief Decodes a JSON string literal starting at the opening quote.
+ *
+ * Handles all escape sequences including \uXXXX surrogate pairs, so titles
+ * with embedded quotes, backslashes or non-BMP characters survive intact
+ * (the old strchr-based scan truncated at the first escaped quote).
+ * Advances *pp past the closing quote; returns NULL on malformed input.
+ */
+static gchar* json_parse_string(const gchar **pp) {
+    const gchar *p = *pp;
+    if (*p != '"') return NULL;
+    p++;
+
+    GString *out = g_string_new(NULL);
+    while (*p && *p != '"') {
+        if (*p == '\\') {
+            p++;
+            switch (*p) {
+                case '"':  g_string_append_c(out, '"');  p++; break;
+                case '\\': g_string_append_c(out, '\\'); p++; break;
+                case '/':  g_string_append_c(out, '/');  p++; break;
+                case 'b':  g_string_append_c(out, '\b'); p++; break;
+                case 'f':  g_string_append_c(out, '\f'); p++; break;
+                case 'n':  g_string_append_c(out, '\n'); p++; break;
+                case 'r':  g_string_append_c(out, '\r'); p++; break;
+                case 't':  g_string_append_c(out, '\t'); p++; break;
+                case 'u': {
+                    p++;
+                    gchar hex[5] = { 0 };
+                    for (gint i = 0; i < 4 && g_ascii_isxdigit(p[i]); i++) hex[i] = p[i];
+                    if (strlen(hex) != 4) {
+                        g_string_free(out, TRUE);
+                        return NULL;
+                    }
+                    gunichar ch = (gunichar)strtol(hex, NULL, 16);
+                    p += 4;
+                    // Combine UTF-16 surrogate pairs into one code point.
+                    if (ch >= 0xD800 && ch <= 0xDBFF && p[0] == '\\' && p[1] == 'u') {
+                        gchar hex_lo[5] = { 0 };
+                        for (gint i = 0; i < 4 && g_ascii_isxdigit(p[2 + i]); i++) hex_lo[i] = p[2 + i];
+                        if (strlen(hex_lo) == 4) {
+                            gunichar lo = (gunichar)strtol(hex_lo, NULL, 16);
+                            if (lo >= 0xDC00 && lo <= 0xDFFF) {
+                                ch = 0x10000 + ((ch - 0xD800) << 10) + (lo - 0xDC00);
+                                p += 6;
+                            }
+                        }
+                    }
+                    if (ch > 0) g_string_append_unichar(out, ch);
+                    break;
+                }
+                default:
+                    g_string_free(out, TRUE);
+                    return NULL;
+            }
+        } else {
+            g_string_append_c(out, *p);
+            p++;
         }
     }
-    gchar *counter_text = g_strdup_printf("%02d", entry->original_detected_counter);
-    gtk_entry_set_text(GTK_ENTRY(entry->counter_entry), counter_text);
-    SAFE_FREE(counter_text);
 
-    GtkWidget *list_box = gtk_widget_get_parent(GTK_WIDGET(op->gui_row));
-    if (list_box && GTK_IS_LIST_BOX(list_box)) {
-        gtk_list_box_invalidate_sort(GTK_LIST_BOX(list_box));
+    if (*p != '"') {
+        g_string_free(out, TRUE);
+        return NULL;
     }
+    *pp = p + 1;
+    return g_string_free(out, FALSE);
+}
 
-    gdouble current_fraction = gtk_progress_bar_get_fraction(GTK_PROGRESS_BAR(progress_bar));
-    if (current_fraction < 0.2) {
-        gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(progress_bar), current_fraction + (0.2 / (global_num_categories * 10.0)));
-        gchar *progress_text = g_strdup_printf("%d%%", (gint)(current_fraction * 100));
-        gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progress_bar), progress_text);
-        SAFE_FREE(progress_text);
-        g_main_context_iteration(NULL, FALSE);
-    }
-    gboolean all_pdfs_processed = TRUE;
-    for (gint i = 0; i < global_num_categories; i++) {
-        GList *l;
-        for (l = global_sections[i].entries; l != NULL; l = g_list_next(l)) {
-            PdfEntry *current_entry = (PdfEntry *)l->data;
-            if (g_strcmp0(gtk_entry_get_text(GTK_ENTRY(current_entry->title_entry)), "Carregando título...") == 0) {
-                all_pdfs_processed = FALSE;
-                break;
+/**
+ * @brief Skips any JSON value (scalar, object or array), respecting strings.
+ */
+static gboolean json_skip_value(const gchar **pp) {
+    const gchar *p = json_skip_ws(*pp);
+
+    if (*p == '"') {
+        gchar *skipped = json_parse_string(&p);
+        if (!skipped) return FALSE;
+        SAFE_FREE(skipped);
+    } else if (*p == '{' || *p == '[') {
+        gint depth = 0;
+        while (*p) {
+            if (*p == '"') {
+                gchar *skipped = json_parse_string(&p);
+                if (!skipped) return FALSE;
+                SAFE_FREE(skipped);
+                continue;
+            }
+            if (*p == '{' || *p == '[') depth++;
+            else if (*p == '}' || *p == ']') {
+                depth--;
+                if (depth == 0) { p++; break; }
             }
+            p++;
         }
-        if (!all_pdfs_processed) break;
+        if (depth != 0) return FALSE;
+    } else {
+        // Number, true, false or null: scan to the next delimiter.
+        while (*p && *p != ',' && *p != '}' && *p != ']' &&
+               *p != ' ' && *p != '\t' && *p != '\n' && *p != '\r') p++;
     }
-    if (all_pdfs_processed) {
-        gtk_label_set_text(GTK_LABEL(status_label), "Carregamento concluído. Pronto para gerar relatório.");
-        gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(progress_bar), 0.2);
-        gchar *progress_text = g_strdup_printf("%d%%", (gint)(0.2 * 100));
-        gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progress_bar), progress_text);
-        SAFE_FREE(progress_text);
-        g_main_context_iteration(NULL, FALSE);
-        const gchar *professor = gtk_combo_box_text_get_active_text(GTK_COMBO_BOX_TEXT(professor_combo));
-        if (professor) {
-            gchar *sanitized_professor_name = sanitize_filename(professor);
-            gchar *pdf_filename = g_strdup_printf("final/%s_relatorio_profissional.pdf", sanitized_professor_name);
-            if (g_file_test(pdf_filename, G_FILE_TEST_EXISTS)) {
-                if (preview_report_btn) {
-                    gtk_widget_show(preview_report_btn);
-                }
+
+    *pp = p;
+    return TRUE;
+}
+
+/**
+ * @brief Parses an exiftool -j buffer in a single forward pass.
+ *
+ * Accepts either a bare object or an array of objects and returns one
+ * ExiftoolJsonRecord per object, in input order. Unknown keys are skipped;
+ * scalar Year values (exiftool emits unquoted numbers for numeric tags) are
+ * captured as strings. Returns an empty array on malformed input.
+ */
+static GPtrArray* exiftool_json_parse(const gchar *json_buf) {
+    GPtrArray *records = g_ptr_array_new_with_free_func(exiftool_json_record_free);
+    if (!json_buf) return records;
+
+    const gchar *p = json_skip_ws(json_buf);
+    if (*p == '[') p = json_skip_ws(p + 1);
+
+    while (*p == '{') {
+        p = json_skip_ws(p + 1);
+        ExiftoolJsonRecord *rec = g_new0(ExiftoolJsonRecord, 1);
+        gboolean object_ok = TRUE;
+
+        while (*p && *p != '}') {
+            gchar *key = json_parse_string(&p);
+            if (!key) { object_ok = FALSE; break; }
+
+            p = json_skip_ws(p);
+            if (*p != ':') { SAFE_FREE(key); object_ok = FALSE; break; }
+            p = json_skip_ws(p + 1);
+
+            gchar *value = NULL;
+            if (*p == '"') {
+                value = json_parse_string(&p);
+                if (!value) { SAFE_FREE(key); object_ok = FALSE; break; }
+            } else if (*p == '{' || *p == '[') {
+                if (!json_skip_value(&p)) { SAFE_FREE(key); object_ok = FALSE; break; }
             } else {
-                if (preview_report_btn) {
-                    gtk_widget_hide(preview_report_btn);
+                const gchar *scalar_start = p;
+                if (!json_skip_value(&p)) { SAFE_FREE(key); object_ok = FALSE; break; }
+                value = g_strndup(scalar_start, p - scalar_start);
+            }
+
+            if (value) {
+                if (g_strcmp0(key, "SourceFile") == 0 && !rec->source_file) {
+                    rec->source_file = value;
+                } else if (g_strcmp0(key, "Title") == 0 && !rec->title) {
+                    rec->title = value;
+                } else if (g_strcmp0(key, "Year") == 0 && !rec->year) {
+                    rec->year = value;
+                } else if (g_strcmp0(key, "Category") == 0 && !rec->category) {
+                    rec->category = value;
+                } else if (g_strcmp0(key, "PageCount") == 0 && !rec->page_count) {
+                    rec->page_count = value;
+                } else {
+                    SAFE_FREE(value);
                 }
             }
-            SAFE_FREE(pdf_filename);
-            SAFE_FREE(sanitized_professor_name);
+            SAFE_FREE(key);
+
+            p = json_skip_ws(p);
+            if (*p == ',') p = json_skip_ws(p + 1);
         }
+
+        if (!object_ok) {
+            exiftool_json_record_free(rec);
+            break;
+        }
+
+        g_ptr_array_add(records, rec);
+        if (*p != '}') break;   /* truncated input */
+        p = json_skip_ws(p + 1);
+        if (*p == ',') p = json_skip_ws(p + 1);
     }
-    SAFE_FREE(extracted_title_local);
-    SAFE_FREE(extracted_year_local);
-    SAFE_FREE(extracted_category_local);
-    SAFE_FREE(stdout_buf);
-    SAFE_FREE(stderr_buf);
-    SAFE_FREE(op->file_path);
-    SAFE_FREE(op);
+
+    return records;
 }
 
+// =============================================================================
+// SESSION STRING ARENA
+// =============================================================================
+
+// Per-session arena for PdfEntry's immutable strings (file_path and the
+// original_* fields). A professor load allocates thousands of small strings
+// that all die together when the professor changes; chunk-allocating them
+// avoids one malloc/free pair each and the heap fragmentation that goes with
+// it. Overwritten values (e.g. re-reads of the same entry) simply linger in
+// the arena until the next reset -- cheap, and bounded by the session.
+static GStringChunk *session_arena = NULL;
+
 /**
- * @brief Callback for file selection. Updates entry and triggers async exiftool.
+ * @brief Copies a string into the session arena (freed wholesale on reset).
  */
-void on_file_set(GtkFileChooserButton *button, GtkListBoxRow *row) {
-    g_print("File set callback triggered.\n");
+gchar* session_strdup(const gchar *text) {
+    if (!text) return NULL;
+    if (!session_arena) {
+        session_arena = g_string_chunk_new(4096);
+    }
+    return g_string_chunk_insert(session_arena, text);
+}
 
-    PdfEntry *entry = g_object_get_data(G_OBJECT(row), "pdf-entry");
-    if (!entry) {
-        g_warning("PdfEntry data not found for the row. Cannot process file selection.");
-        return;
+/**
+ * @brief Interns a string in the session arena: equal strings share one
+ * copy. Used for years and category names, which repeat across entries.
+ */
+gchar* session_intern(const gchar *text) {
+    if (!text) return NULL;
+    if (!session_arena) {
+        session_arena = g_string_chunk_new(4096);
     }
+    return g_string_chunk_insert_const(session_arena, text);
+}
 
-    gchar *file_path = gtk_file_chooser_get_filename(GTK_FILE_CHOOSER(button));
-    if (!file_path) {
-        g_warning("No file path selected. Skipping processing.");
-        return;
+/**
+ * @brief Frees every arena string at once. Only valid once no live PdfEntry
+ * references arena memory (professor teardown / final cleanup).
+ */
+void session_arena_reset(void) {
+    if (session_arena) {
+        g_string_chunk_free(session_arena);
+        session_arena = NULL;
     }
+}
 
-    if (!is_valid_path(file_path)) {
-        g_warning("Selected file path is invalid: %s", file_path);
-        SAFE_FREE(file_path);
+// =============================================================================
+// LOAD PROGRESS TRACKING
+// =============================================================================
+
+/**
+ * @brief Records that one metadata read has been queued.
+ *
+ * Together with pdf_load_track_finished() this replaces the old completion
+ * check that re-scanned every entry's title text after each read.
+ */
+void pdf_load_track_queued(void) {
+    pdf_loads_outstanding++;
+    pdf_loads_total++;
+}
+
+/**
+ * @brief Records that one metadata read has been applied (or discarded).
+ *
+ * Drives the loading progress fraction (the 0.0-0.2 span belongs to the
+ * loading phase) and, once the last outstanding read finishes, the
+ * "Carregamento concluído" status and the preview button visibility.
+ * Results from a previous professor load carry an older @generation and
+ * are ignored; the counters were reset when that load was cancelled.
+ */
+void pdf_load_track_finished(guint generation) {
+    if (generation != pdf_load_generation) {
         return;
     }
+    if (pdf_loads_outstanding > 0) {
+        pdf_loads_outstanding--;
+    }
 
-    g_print("  Selected file: %s\n", file_path);
+    gint completed = pdf_loads_total - pdf_loads_outstanding;
+    gdouble fraction = pdf_loads_total > 0 ? 0.2 * ((gdouble)completed / pdf_loads_total) : 0.2;
+    gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(progress_bar), fraction);
+    gchar *progress_text = g_strdup_printf("%d%%", (gint)(fraction * 100));
+    gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progress_bar), progress_text);
+    SAFE_FREE(progress_text);
 
-    SAFE_FREE(entry->file_path);
-    entry->file_path = g_strdup(file_path);
-    SAFE_FREE(file_path);
+    if (pdf_loads_outstanding > 0) {
+        return;
+    }
 
-    gtk_entry_set_text(GTK_ENTRY(entry->title_entry), "Carregando título...");
-    gtk_entry_set_text(GTK_ENTRY(entry->year_entry), "Carregando ano...");
-    gtk_entry_set_text(GTK_ENTRY(entry->category_entry), "Carregando categoria...");
+    pdf_loads_total = 0;
+    pdf_load_completed_ui();
+}
 
-    gint category_index = -1;
-    GtkWidget *list_box = gtk_widget_get_parent(GTK_WIDGET(row));
-    if (list_box) {
-        for (gint i = 0; i < global_num_categories; i++) {
-            if (global_sections[i].list == list_box) {
-                category_index = i;
-                break;
+/**
+ * @brief Shows the loaded state: status text and preview button visibility.
+ */
+void pdf_load_completed_ui(void) {
+    gtk_label_set_text(GTK_LABEL(status_label), "Carregamento concluído. Pronto para gerar relatório.");
+    g_main_context_iteration(NULL, FALSE);
+
+    const gchar *professor = gtk_combo_box_text_get_active_text(GTK_COMBO_BOX_TEXT(professor_combo));
+    if (professor) {
+        gchar *sanitized_professor_name = sanitize_filename(professor);
+        gchar *pdf_filename = g_strdup_printf("final/%s_relatorio_profissional.pdf", sanitized_professor_name);
+        if (g_file_test(pdf_filename, G_FILE_TEST_EXISTS)) {
+            if (preview_report_btn) {
+                gtk_widget_show(preview_report_btn);
+            }
+        } else {
+            if (preview_report_btn) {
+                gtk_widget_hide(preview_report_btn);
             }
         }
+        SAFE_FREE(pdf_filename);
+        SAFE_FREE(sanitized_professor_name);
     }
-    if (category_index == -1) {
-        g_warning("Could not determine category index for the selected PDF. Exiftool processing might be affected.");
-    }
+}
 
-    ExiftoolReadOperation *op = g_malloc0(sizeof(ExiftoolReadOperation));
-    op->file_path = g_strdup(entry->file_path);
-    op->gui_row = row;
-    op->category_index = category_index;
-    op->is_new_file_selection = TRUE;
+/**
+ * @brief Applies extracted metadata (exiftool JSON or filename fallback) to a PdfEntry.
+ *
+ * Shared by the per-process child-watch path and the persistent daemon path.
+ * Consumes @op (frees the struct and its file_path).
+ */
+void exiftool_apply_metadata(ExiftoolReadOperation *op, const gchar *json_buf, gboolean exiftool_ok, const gchar *error_text) {
+    const gchar *json_title = NULL;
+    const gchar *json_year = NULL;
+    const gchar *json_category = NULL;
+    GPtrArray *records = NULL;
+
+    if (exiftool_ok && json_buf) {
+        trace_log(TRACE_METADATA_READ, "exiftool JSON raw output: %s", json_buf);
+
+        records = exiftool_json_parse(json_buf);
+        if (records->len > 0) {
+            ExiftoolJsonRecord *rec = g_ptr_array_index(records, 0);
+            json_title = rec->title;
+            json_year = rec->year;
+            json_category = rec->category;
+        }
 
-    gchar *quoted_file_path = g_shell_quote(op->file_path);
-    gchar *command_line = g_strdup_printf("exiftool -j -Title -Year -Category %s", quoted_file_path);
-    SAFE_FREE(quoted_file_path);
+        trace_log(TRACE_METADATA_READ, "tags for %s: title=%s year=%s category=%s",
+                  op->file_path,
+                  json_title ? json_title : "(none)",
+                  json_year ? json_year : "(none)",
+                  json_category ? json_category : "(none)");
+    } else {
+        g_warning("  [Main Thread] Exiftool command failed for %s. Stderr: %s",
+                  op->file_path, error_text && *error_text ? error_text : "(empty)");
+    }
 
-    gchar **argv = NULL;
-    gint argc = 0;
-    GError *spawn_error = NULL;
-    gboolean success = g_shell_parse_argv(command_line, &argc, &argv, &spawn_error);
-    if (!success) {
-        g_warning("Failed to parse exiftool command line for new file: %s (%s)", command_line, spawn_error ? spawn_error->message : "N/A");
-        if (spawn_error) g_error_free(spawn_error);
-        SAFE_FREE(command_line);
-        SAFE_FREE(op->file_path);
-        SAFE_FREE(op);
-        return;
+    gint json_pages = 0;
+    if (records && records->len > 0) {
+        ExiftoolJsonRecord *rec = g_ptr_array_index(records, 0);
+        json_pages = rec->page_count ? atoi(rec->page_count) : 0;
     }
+    pdf_entry_populate_metadata(op, json_title, json_year, json_category, json_pages);
 
-    GPid pid;
-    gint stdout_fd_local, stderr_fd_local;
-    if (!g_spawn_async_with_pipes(NULL, argv, NULL, G_SPAWN_SEARCH_PATH | G_SPAWN_DO_NOT_REAP_CHILD,
-                                  NULL, NULL, &pid, NULL, &stdout_fd_local, &stderr_fd_local, &spawn_error)) {
-        g_warning("Failed to spawn exiftool process for new file: %s", spawn_error ? spawn_error->message : "N/A");
-        if (spawn_error) g_error_free(spawn_error);
+    if (records) g_ptr_array_free(records, TRUE);
+}
+
+/**
+ * @brief Fills a PdfEntry's fields and widgets from extracted metadata.
+ *
+ * @title/@year/@category may be NULL, in which case the values fall back to
+ * the filename-derived heuristics. Consumes @op. Fresh (non-cached) results
+ * are persisted to the folder's sidecar metadata cache.
+ */
+void pdf_entry_populate_metadata(ExiftoolReadOperation *op, const gchar *title, const gchar *year, const gchar *category, gint page_count) {
+    PdfEntry *entry = op->entry;
+
+    if (!entry || op->generation != pdf_load_generation) {
+        // The entry lists were cleared (professor switched) while this read
+        // was in flight; the PdfEntry pointer is no longer valid.
+        g_print("Discarding stale exiftool result for %s\n", op->file_path ? op->file_path : "N/A");
+        pdf_load_track_finished(op->generation);
         SAFE_FREE(op->file_path);
         SAFE_FREE(op);
-        g_strfreev(argv);
-        SAFE_FREE(command_line);
         return;
     }
 
-    op->stdout_fd = stdout_fd_local;
-    op->stderr_fd = stderr_fd_local;
+    trace_log(TRACE_METADATA_READ, "updating GUI for %s", op->file_path);
 
-    g_strfreev(argv);
-    SAFE_FREE(command_line);
+    gchar *extracted_title_local = NULL;
+    gchar *extracted_year_local = NULL;
+    gchar *extracted_category_local = NULL;
+    gchar *original_filename_no_ext_local = NULL;
 
-    g_child_watch_add(pid, exiftool_read_completed_callback, op);
-}
+    gchar *basename = g_path_get_basename(op->file_path);
+    gchar *basename_copy = g_strdup(basename);
+    gchar *filename_no_ext_ptr = g_strrstr(basename_copy, ".");
+    if (filename_no_ext_ptr) {
+        *filename_no_ext_ptr = '\0';
+    }
+    original_filename_no_ext_local = g_strdup(basename_copy);
 
-/**
- * @brief Callback for counter entry changes. Updates internal value and re-sorts list.
- */
-void on_counter_entry_changed(GtkEditable *editable, PdfEntry *entry) {
-    const gchar *text = gtk_entry_get_text(GTK_ENTRY(editable));
-    gint new_val = atoi(text);
-    if (new_val < 0) new_val = 0;
+    if (strlen(basename_copy) >= 3 && g_ascii_isdigit(basename_copy[0]) &&
+        g_ascii_isdigit(basename_copy[1]) && basename_copy[2] == '_') {
+        gchar counter_str[3];
+        counter_str[0] = basename_copy[0];
+        counter_str[1] = basename_copy[1];
+        counter_str[2] = '\0';
+        gint counter_val = atoi(counter_str);
 
-    if (entry->current_counter_value != new_val) {
-        entry->current_counter_value = new_val;
+        if (counter_val > 0) {
+            entry->has_original_counter = TRUE;
+            entry->original_detected_counter = counter_val;
+            extracted_title_local = g_strdup(basename_copy + 3);
+        }
+    }
+    if (!extracted_title_local) {
+        extracted_title_local = g_strdup(basename_copy);
+    }
+    SAFE_FREE(basename_copy);
+    SAFE_FREE(basename);
 
-        GtkWidget *parent_row = gtk_widget_get_parent(entry->box);
-        if (parent_row && GTK_IS_LIST_BOX_ROW(parent_row)) {
-            GtkWidget *list_box = gtk_widget_get_parent(parent_row);
-            if (list_box && GTK_IS_LIST_BOX(list_box)) {
-                gtk_list_box_invalidate_sort(GTK_LIST_BOX(list_box));
+    if (title && *title) {
+        SAFE_FREE(extracted_title_local);
+        extracted_title_local = g_strdup(title);
+    }
+    if (year && *year) {
+        extracted_year_local = g_strdup(year);
+    }
+    if (category && *category) {
+        extracted_category_local = g_strdup(category);
+    }
+
+    if (!extracted_year_local) {
+        gchar *temp_filename_for_year_parsing = g_path_get_basename(op->file_path);
+        gchar *filename_no_ext_temp = g_strrstr(temp_filename_for_year_parsing, ".");
+        if (filename_no_ext_temp) {
+            *filename_no_ext_temp = '\0';
+        }
+        gchar *last_underscore = g_strrstr(temp_filename_for_year_parsing, "_");
+        if (last_underscore && strlen(last_underscore + 1) == 4) {
+            gboolean is_numeric = TRUE;
+            for (gint k = 0; k < 4; k++) {
+                if (!g_ascii_isdigit(last_underscore[1 + k])) {
+                    is_numeric = FALSE;
+                    break;
+                }
+            }
+            if (is_numeric) {
+                extracted_year_local = g_strdup(last_underscore + 1);
             }
         }
+        SAFE_FREE(temp_filename_for_year_parsing);
+    }
+
+    if (!extracted_category_local && op->category_index >= 0 && op->category_index < global_num_categories) {
+        extracted_category_local = g_strdup(global_categories[op->category_index]);
+    } else if (!extracted_category_local) {
+        extracted_category_local = g_strdup("documento");
+    }
+
+    pdf_entry_set_title(entry, extracted_title_local ? extracted_title_local : "Título Não Informado");
+    pdf_entry_set_year(entry, extracted_year_local ? extracted_year_local : "");
+    pdf_entry_set_category(entry, extracted_category_local);
+
+    entry->original_title = session_strdup(extracted_title_local ? extracted_title_local : "Título Não Informado");
+    entry->original_year = session_intern(extracted_year_local ? extracted_year_local : "");
+    entry->original_category = session_intern(extracted_category_local);
+    entry->original_filename_no_ext = session_strdup(original_filename_no_ext_local);
+    entry->current_counter_value = entry->original_detected_counter;
+    if (page_count > 0) {
+        entry->page_count = page_count;
+    }
+
+    // op->category_index was captured at queue time; the generation check
+    // above keeps it current, but never write past the live table.
+    if (!op->is_new_file_selection && entry->original_detected_counter > 0 &&
+        op->category_index >= 0 && op->category_index < global_num_categories) {
+        if (entry->original_detected_counter > global_max_category_counters[op->category_index]) {
+            global_max_category_counters[op->category_index] = entry->original_detected_counter;
+        }
     }
+    gchar *counter_text = g_strdup_printf("%02d", entry->original_detected_counter);
+    pdf_entry_set_counter(entry, counter_text);
+    SAFE_FREE(counter_text);
+
+    if (entry->row) {
+        GtkWidget *list_box = gtk_widget_get_parent(GTK_WIDGET(entry->row));
+        if (list_box && GTK_IS_LIST_BOX(list_box)) {
+            list_box_schedule_sort(GTK_LIST_BOX(list_box));
+        }
+    }
+
+    pdf_load_track_finished(op->generation);
+
+    if (!op->from_cache && op->file_mtime > 0) {
+        gchar *folder = g_path_get_dirname(op->file_path);
+        gchar *file_basename = g_path_get_basename(op->file_path);
+        metadata_cache_append(folder, file_basename, op->file_mtime, op->file_size,
+                              extracted_title_local, extracted_year_local, extracted_category_local,
+                              entry->page_count);
+        SAFE_FREE(folder);
+        SAFE_FREE(file_basename);
+    }
+
+    SAFE_FREE(extracted_title_local);
+    SAFE_FREE(extracted_year_local);
+    SAFE_FREE(extracted_category_local);
+    SAFE_FREE(original_filename_no_ext_local);
+    SAFE_FREE(op->file_path);
+    SAFE_FREE(op);
 }
 
+// =============================================================================
+// SIDECAR METADATA CACHE
+// =============================================================================
+
 /**
- * @brief Callback for category entry changes. Updates internal category string.
+ * @brief Frees a MetadataCacheEntry (GDestroyNotify).
  */
-void on_category_entry_changed(GtkEditable *editable, PdfEntry *entry) {
-    const gchar *new_category = gtk_entry_get_text(GTK_ENTRY(editable));
-    g_print("Category changed for %s to: %s\n", entry->file_path ? entry->file_path : "N/A", new_category);
-    SAFE_FREE(entry->original_category);
-    entry->original_category = g_strdup(new_category);
+static void metadata_cache_entry_free(gpointer data) {
+    MetadataCacheEntry *cache_entry = (MetadataCacheEntry *)data;
+    if (cache_entry) {
+        SAFE_FREE(cache_entry->title);
+        SAFE_FREE(cache_entry->year);
+        SAFE_FREE(cache_entry->category);
+        SAFE_FREE(cache_entry);
+    }
 }
 
 /**
- * @brief Compares PdfEntries by their current_counter_value for sorting.
+ * @brief Replaces tab/newline characters so a value fits one cache line.
  */
-gint compare_pdf_entries_by_counter(GtkListBoxRow *row1, GtkListBoxRow *row2, gpointer user_data) {
-    (void)user_data;
-
-    PdfEntry *entry_a = g_object_get_data(G_OBJECT(row1), "pdf-entry");
-    PdfEntry *entry_b = g_object_get_data(G_OBJECT(row2), "pdf-entry");
-
-    if (!entry_a || !entry_b) return 0;
+static gchar* metadata_cache_sanitize_field(const gchar *value) {
+    gchar *copy = g_strdup(value ? value : "");
+    for (gchar *p = copy; *p; p++) {
+        if (*p == '\t' || *p == '\n' || *p == '\r') *p = ' ';
+    }
+    return copy;
+}
 
-    gint counter_a = entry_a->current_counter_value;
-    gint counter_b = entry_b->current_counter_value;
+/**
+ * @brief Loads the sidecar metadata cache of a category folder.
+ *
+ * The cache is an append-only, tab-separated file; on load the last record
+ * for a basename wins. Returns a hash table of basename -> MetadataCacheEntry
+ * (never NULL; empty when no cache exists).
+ */
+GHashTable* metadata_cache_load(const gchar *folder_path) {
+    GHashTable *cache = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, metadata_cache_entry_free);
+
+    gchar *cache_path = g_build_filename(folder_path, METADATA_CACHE_FILENAME, NULL);
+    gchar *contents = NULL;
+    if (!g_file_get_contents(cache_path, &contents, NULL, NULL)) {
+        SAFE_FREE(cache_path);
+        return cache;
+    }
+    SAFE_FREE(cache_path);
+
+    gchar **lines = g_strsplit(contents, "\n", -1);
+    SAFE_FREE(contents);
+
+    for (gint i = 0; lines[i] != NULL; i++) {
+        if (*lines[i] == '\0') continue;
+        gchar **fields = g_strsplit(lines[i], "\t", 7);
+        guint n_fields = g_strv_length(fields);
+        if (n_fields >= 6) {
+            MetadataCacheEntry *cache_entry = g_new0(MetadataCacheEntry, 1);
+            cache_entry->mtime = g_ascii_strtoll(fields[1], NULL, 10);
+            cache_entry->size = g_ascii_strtoll(fields[2], NULL, 10);
+            cache_entry->title = g_strdup(fields[3]);
+            cache_entry->year = g_strdup(fields[4]);
+            cache_entry->category = g_strdup(fields[5]);
+            if (n_fields >= 7) {
+                cache_entry->page_count = atoi(fields[6]);
+            }
+            g_hash_table_replace(cache, g_strdup(fields[0]), cache_entry);
+        }
+        g_strfreev(fields);
+    }
+    g_strfreev(lines);
 
-    return counter_a - counter_b;
+    return cache;
 }
 
 /**
- * @brief Frees dynamically allocated memory within a PdfEntry struct.
+ * @brief Appends one record to a folder's sidecar metadata cache.
  */
-void pdf_entry_destroy_notify(gpointer data) {
-    PdfEntry *entry = (PdfEntry *)data;
-    if (entry) {
-        g_print("Freeing PdfEntry data for: %s (GDestroyNotify)\n", entry->file_path ? entry->file_path : "N/A");
-        SAFE_FREE(entry->file_path);
-        SAFE_FREE(entry->original_title);
-        SAFE_FREE(entry->original_year);
-        SAFE_FREE(entry->original_category);
-        SAFE_FREE(entry->original_filename_no_ext);
-        SAFE_FREE(entry);
+void metadata_cache_append(const gchar *folder_path, const gchar *file_basename, gint64 mtime, gint64 size,
+                           const gchar *title, const gchar *year, const gchar *category, gint page_count) {
+    /* Serializes appends: save workers on the thread pool may write to the
+     * same per-folder cache file concurrently. */
+    static GMutex cache_append_mutex;
+
+    gchar *cache_path = g_build_filename(folder_path, METADATA_CACHE_FILENAME, NULL);
+
+    g_mutex_lock(&cache_append_mutex);
+    FILE *fp = fopen(cache_path, "a");
+    if (!fp) {
+        g_warning("Could not open metadata cache '%s' for append: %s", cache_path, g_strerror(errno));
+        g_mutex_unlock(&cache_append_mutex);
+        SAFE_FREE(cache_path);
+        return;
     }
+
+    gchar *safe_title = metadata_cache_sanitize_field(title);
+    gchar *safe_year = metadata_cache_sanitize_field(year);
+    gchar *safe_category = metadata_cache_sanitize_field(category);
+
+    fprintf(fp, "%s\t%" G_GINT64_FORMAT "\t%" G_GINT64_FORMAT "\t%s\t%s\t%s\t%d\n",
+            file_basename, mtime, size, safe_title, safe_year, safe_category, page_count);
+    fclose(fp);
+    g_mutex_unlock(&cache_append_mutex);
+
+    SAFE_FREE(safe_title);
+    SAFE_FREE(safe_year);
+    SAFE_FREE(safe_category);
+    SAFE_FREE(cache_path);
 }
 
+// =============================================================================
+// PERSISTENT EXIFTOOL DAEMON (-stay_open)
+// =============================================================================
+
 /**
- * @brief Sanitizes a string for use as a filename.
+ * @brief Handles incoming data on the daemon's stdout pipe.
+ *
+ * Accumulates output until a "{ready}" marker, then dispatches the completed
+ * JSON payload to the oldest pending read operation.
  */
-gchar* sanitize_filename(const gchar *input) {
-    if (!input) return g_strdup("documento_sem_titulo");
-
-    GString *clean_string = g_string_new("");
-    const gchar *p = input;
-    gunichar c;
-
-    while (*p) {
-        c = g_utf8_get_char(p);
-        if (c == '/' || c == '\\' || c == ':' || c == '*' || c == '?' ||
-            c == '\"' || c == '<' || c == '>' || c == '|' || c == '\0') {
-            g_string_append_unichar(clean_string, '_');
-        } else if (g_unichar_isspace(c)) {
-            g_string_append_unichar(clean_string, '_');
-        } else {
-            g_string_append_unichar(clean_string, c);
+static gboolean exiftool_daemon_stdout_ready(GIOChannel *channel, GIOCondition condition, gpointer user_data) {
+    (void)user_data;
+
+    if (condition & G_IO_IN) {
+        gchar chunk[4096];
+        gsize bytes_read = 0;
+        GIOStatus io_status = g_io_channel_read_chars(channel, chunk, sizeof(chunk), &bytes_read, NULL);
+        if (bytes_read > 0) {
+            g_string_append_len(exiftool_daemon.read_buffer, chunk, bytes_read);
+        }
+        if (io_status == G_IO_STATUS_EOF) {
+            condition |= G_IO_HUP;
         }
-        p = g_utf8_next_char(p);
     }
 
-    gchar *temp_sanitized = g_string_free(clean_string, FALSE);
+    gchar *ready_marker;
+    while ((ready_marker = g_strstr_len(exiftool_daemon.read_buffer->str, exiftool_daemon.read_buffer->len, "{ready}")) != NULL) {
+        gsize payload_len = ready_marker - exiftool_daemon.read_buffer->str;
+        gchar *payload = g_strndup(exiftool_daemon.read_buffer->str, payload_len);
 
-    GString *final_sanitized = g_string_new("");
-    gboolean last_was_underscore = FALSE;
-    const gchar *current_char_ptr = temp_sanitized;
+        gsize consumed = payload_len + strlen("{ready}");
+        while (consumed < exiftool_daemon.read_buffer->len &&
+               (exiftool_daemon.read_buffer->str[consumed] == '\n' || exiftool_daemon.read_buffer->str[consumed] == '\r')) {
+            consumed++;
+        }
+        g_string_erase(exiftool_daemon.read_buffer, 0, consumed);
 
-    while (*current_char_ptr) {
-        if (*current_char_ptr == '_') {
-            if (!last_was_underscore) {
-                g_string_append_unichar(final_sanitized, '_');
-            }
-            last_was_underscore = TRUE;
+        ExiftoolReadOperation *op = g_queue_pop_head(exiftool_daemon.pending_ops);
+        if (op) {
+            exiftool_apply_metadata(op, payload, TRUE, NULL);
         } else {
-            g_string_append_unichar(final_sanitized, g_utf8_get_char(current_char_ptr));
-            last_was_underscore = FALSE;
+            g_warning("Exiftool daemon produced a response with no pending operation. Discarding.");
         }
-        current_char_ptr = g_utf8_next_char(current_char_ptr);
+        SAFE_FREE(payload);
     }
 
-    SAFE_FREE(temp_sanitized);
-
-    gchar *result = g_string_free(final_sanitized, FALSE);
-    gchar *trimmed_result = g_strstrip(result);
+    if (condition & (G_IO_HUP | G_IO_ERR)) {
+        g_warning("Exiftool daemon pipe closed unexpectedly. Falling back to per-file processes.");
+        exiftool_daemon.running = FALSE;
+        exiftool_daemon.stdout_watch_id = 0;
 
-    if (g_strcmp0(trimmed_result, "") == 0) {
-        SAFE_FREE(result);
-        return g_strdup("documento_sem_titulo");
+        ExiftoolReadOperation *orphan;
+        while ((orphan = g_queue_pop_head(exiftool_daemon.pending_ops)) != NULL) {
+            if (!spawn_exiftool_read(orphan)) {
+                exiftool_apply_metadata(orphan, NULL, FALSE, "exiftool daemon terminated");
+            }
+        }
+        return G_SOURCE_REMOVE;
     }
 
-    return result;
+    return G_SOURCE_CONTINUE;
 }
 
 /**
- * @brief Creates and initializes a new PdfEntry struct.
+ * @brief Starts the long-lived exiftool worker process.
+ *
+ * Uses 'exiftool -stay_open True -@ -' so subsequent metadata reads are one
+ * pipe round-trip instead of a ~200ms Perl interpreter startup per file.
  */
-PdfEntry* create_pdf_entry() {
-    PdfEntry *entry = g_new0(PdfEntry, 1);
-    entry->file_path = NULL;
-    entry->original_title = NULL;
-    entry->original_year = NULL;
-    entry->original_category = NULL;
-    entry->original_filename_no_ext = NULL;
-    entry->has_original_counter = FALSE;
-    entry->original_detected_counter = 0;
-    entry->current_counter_value = 0;
-    return entry;
+gboolean exiftool_daemon_start(void) {
+    if (exiftool_daemon.running) return TRUE;
+
+    gchar *argv[] = { (gchar*)"exiftool", (gchar*)"-stay_open", (gchar*)"True", (gchar*)"-@", (gchar*)"-", NULL };
+    GError *spawn_error = NULL;
+
+    if (!g_spawn_async_with_pipes(NULL, argv, NULL, G_SPAWN_SEARCH_PATH,
+                                  NULL, NULL, &exiftool_daemon.pid,
+                                  &exiftool_daemon.stdin_fd, &exiftool_daemon.stdout_fd, NULL, &spawn_error)) {
+        g_warning("Failed to start persistent exiftool daemon: %s. Will use per-file processes.",
+                  spawn_error ? spawn_error->message : "N/A");
+        if (spawn_error) g_error_free(spawn_error);
+        return FALSE;
+    }
+
+    exiftool_daemon.read_buffer = g_string_new("");
+    exiftool_daemon.pending_ops = g_queue_new();
+    exiftool_daemon.stdout_channel = g_io_channel_unix_new(exiftool_daemon.stdout_fd);
+    g_io_channel_set_encoding(exiftool_daemon.stdout_channel, NULL, NULL);
+    g_io_channel_set_flags(exiftool_daemon.stdout_channel, G_IO_FLAG_NONBLOCK, NULL);
+    exiftool_daemon.stdout_watch_id = g_io_add_watch(exiftool_daemon.stdout_channel,
+                                                     G_IO_IN | G_IO_HUP | G_IO_ERR,
+                                                     exiftool_daemon_stdout_ready, NULL);
+    exiftool_daemon.running = TRUE;
+
+    g_print("Persistent exiftool daemon started (PID: %d).\n", exiftool_daemon.pid);
+    trace_count(TRACE_COUNT_PROCESSES_SPAWNED, 1);
+    return TRUE;
 }
 
 /**
- * @brief Creates a GtkListBoxRow with widgets for a PdfEntry.
+ * @brief Asks the daemon to exit cleanly and releases its resources.
  */
-GtkListBoxRow* create_pdf_entry_row(PdfEntry *entry, gint category_index) {
-    (void)category_index;
+void exiftool_daemon_shutdown(void) {
+    if (!exiftool_daemon.running) return;
 
-    GtkListBoxRow *row = GTK_LIST_BOX_ROW(gtk_list_box_row_new());
-    entry->box = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 5);
+    const gchar *quit_cmd = "-stay_open\nFalse\n";
+    if (write(exiftool_daemon.stdin_fd, quit_cmd, strlen(quit_cmd)) < 0) {
+        g_warning("Failed to send shutdown command to exiftool daemon: %s", g_strerror(errno));
+    }
+    close(exiftool_daemon.stdin_fd);
 
-    g_object_set_data_full(G_OBJECT(row), "pdf-entry", entry, pdf_entry_destroy_notify);
+    if (exiftool_daemon.stdout_watch_id) {
+        g_source_remove(exiftool_daemon.stdout_watch_id);
+        exiftool_daemon.stdout_watch_id = 0;
+    }
+    if (exiftool_daemon.stdout_channel) {
+        g_io_channel_unref(exiftool_daemon.stdout_channel);
+        exiftool_daemon.stdout_channel = NULL;
+    }
+    close(exiftool_daemon.stdout_fd);
+    g_spawn_close_pid(exiftool_daemon.pid);
 
-    entry->file_btn = gtk_file_chooser_button_new("Selecionar PDF", GTK_FILE_CHOOSER_ACTION_OPEN);
-    gtk_widget_set_size_request(entry->file_btn, 150, -1);
-    gtk_box_pack_start(GTK_BOX(entry->box), entry->file_btn, FALSE, FALSE, 0);
-    g_signal_connect(G_OBJECT(entry->file_btn), "file-set", G_CALLBACK(on_file_set), row);
+    if (exiftool_daemon.read_buffer) {
+        g_string_free(exiftool_daemon.read_buffer, TRUE);
+        exiftool_daemon.read_buffer = NULL;
+    }
+    if (exiftool_daemon.pending_ops) {
+        g_queue_free_full(exiftool_daemon.pending_ops, g_free);
+        exiftool_daemon.pending_ops = NULL;
+    }
+    exiftool_daemon.running = FALSE;
+    g_print("Persistent exiftool daemon shut down.\n");
+}
 
-    entry->counter_entry = gtk_entry_new();
-    gtk_entry_set_width_chars(GTK_ENTRY(entry->counter_entry), 3);
-    gtk_entry_set_max_length(GTK_ENTRY(entry->counter_entry), 2);
-    gtk_entry_set_placeholder_text(GTK_ENTRY(entry->counter_entry), "NN");
-    gtk_box_pack_start(GTK_BOX(entry->box), entry->counter_entry, FALSE, FALSE, 5);
-    g_signal_connect(G_OBJECT(entry->counter_entry), "changed", G_CALLBACK(on_counter_entry_changed), entry);
+/**
+ * @brief Submits a metadata read to the persistent daemon.
+ *
+ * Takes ownership of @op on success. Returns FALSE (without consuming @op)
+ * if the daemon is not available, so the caller can fall back to a spawn.
+ */
+gboolean exiftool_daemon_submit(ExiftoolReadOperation *op) {
+    if (!exiftool_daemon.running && !exiftool_daemon_start()) {
+        return FALSE;
+    }
 
-    entry->title_entry = gtk_entry_new();
-    gtk_entry_set_placeholder_text(GTK_ENTRY(entry->title_entry), "Título do PDF");
-    gtk_widget_set_hexpand(entry->title_entry, TRUE);
-    gtk_box_pack_start(GTK_BOX(entry->box), entry->title_entry, TRUE, TRUE, 0);
+    gchar *request = g_strdup_printf("-j\n-Title\n-Year\n-Category\n-PageCount\n%s\n-execute\n", op->file_path);
+    gsize request_len = strlen(request);
+    gssize written = write(exiftool_daemon.stdin_fd, request, request_len);
+    SAFE_FREE(request);
 
-    entry->year_entry = gtk_entry_new();
-    gtk_entry_set_width_chars(GTK_ENTRY(entry->year_entry), 5);
-    gtk_entry_set_max_length(GTK_ENTRY(entry->year_entry), 4);
-    gtk_entry_set_placeholder_text(GTK_ENTRY(entry->year_entry), "Ano");
-    gtk_box_pack_start(GTK_BOX(entry->box), entry->year_entry, FALSE, FALSE, 5);
+    if (written < 0 || (gsize)written != request_len) {
+        g_warning("Failed to write request to exiftool daemon: %s", g_strerror(errno));
+        exiftool_daemon.running = FALSE;
+        return FALSE;
+    }
 
-    entry->category_entry = gtk_entry_new();
-    gtk_entry_set_width_chars(GTK_ENTRY(entry->category_entry), 15);
-    gtk_entry_set_placeholder_text(GTK_ENTRY(entry->category_entry), "Categoria (ex: artigo)");
-    gtk_box_pack_start(GTK_BOX(entry->box), entry->category_entry, FALSE, FALSE, 5);
-    g_signal_connect(G_OBJECT(entry->category_entry), "changed", G_CALLBACK(on_category_entry_changed), entry);
+    g_queue_push_tail(exiftool_daemon.pending_ops, op);
+    return TRUE;
+}
 
-    entry->preview_btn = gtk_button_new_with_label("Visualizar");
-    gtk_box_pack_start(GTK_BOX(entry->box), entry->preview_btn, FALSE, FALSE, 5);
-    g_signal_connect(G_OBJECT(entry->preview_btn), "clicked", G_CALLBACK(on_preview_pdf), entry);
+/**
+ * @brief Spawns a one-shot exiftool process for a single read operation.
+ *
+ * Fallback path used when the persistent daemon is unavailable. Takes
+ * ownership of @op on success.
+ */
+gboolean spawn_exiftool_read(ExiftoolReadOperation *op) {
+    gchar *quoted_file_path = g_shell_quote(op->file_path);
+    gchar *command_line = g_strdup_printf("exiftool -j -Title -Year -Category -PageCount %s", quoted_file_path);
+    SAFE_FREE(quoted_file_path);
 
-    entry->remove_btn = gtk_button_new_with_label("Remover");
-    gtk_box_pack_start(GTK_BOX(entry->box), entry->remove_btn, FALSE, FALSE, 0);
-    g_signal_connect(G_OBJECT(entry->remove_btn), "clicked", G_CALLBACK(on_remove_pdf_entry), entry);
+    gchar **argv = NULL;
+    gint argc = 0;
+    GError *spawn_error = NULL;
+    gboolean success = g_shell_parse_argv(command_line, &argc, &argv, &spawn_error);
+    if (!success) {
+        g_warning("Failed to parse exiftool command line: %s (%s)", command_line, spawn_error ? spawn_error->message : "N/A");
+        if (spawn_error) g_error_free(spawn_error);
+        SAFE_FREE(command_line);
+        return FALSE;
+    }
 
-    gtk_container_add(GTK_CONTAINER(row), entry->box);
-    gtk_widget_show_all(entry->box);
+    GPid pid;
+    gint stdout_fd_local, stderr_fd_local;
+    if (!g_spawn_async_with_pipes(NULL, argv, NULL, G_SPAWN_SEARCH_PATH | G_SPAWN_DO_NOT_REAP_CHILD,
+                                  NULL, NULL, &pid, NULL, &stdout_fd_local, &stderr_fd_local, &spawn_error)) {
+        g_warning("Failed to spawn exiftool process: %s", spawn_error ? spawn_error->message : "N/A");
+        if (spawn_error) g_error_free(spawn_error);
+        g_strfreev(argv);
+        SAFE_FREE(command_line);
+        return FALSE;
+    }
 
-    return row;
+    g_strfreev(argv);
+    SAFE_FREE(command_line);
+
+    trace_count(TRACE_COUNT_PROCESSES_SPAWNED, 1);
+    exiftool_spawn_watch_new(pid, stdout_fd_local, stderr_fd_local, exiftool_read_drained, op);
+    return TRUE;
 }
 
+// =============================================================================
+// BATCHED PER-FOLDER METADATA EXTRACTION
+// =============================================================================
+
 /**
- * @brief Adds a PdfEntry to the GUI and its category's entry list.
+ * @brief Demultiplexes a batched exiftool JSON array back to its operations.
+ *
+ * Each top-level object in the array carries a "SourceFile" key matching the
+ * path the operation was queued with; unmatched operations fall back to
+ * filename-derived metadata.
  */
-void add_pdf_entry_to_gui(gint category_index, PdfEntry *entry, GtkListBoxRow *row) {
-    if (category_index >= 0 && category_index < global_num_categories) {
-        gtk_list_box_insert(GTK_LIST_BOX(global_sections[category_index].list), GTK_WIDGET(row), -1);
-        global_sections[category_index].entries = g_list_append(global_sections[category_index].entries, entry);
-        gtk_widget_show_all(GTK_WIDGET(row));
-    } else {
-        g_warning("Invalid category index %d for adding PDF entry to GUI.", category_index);
+static void exiftool_batch_dispatch(GPtrArray *ops, const gchar *json_buf, gboolean exiftool_ok, const gchar *error_text) {
+    GHashTable *op_by_path = g_hash_table_new(g_str_hash, g_str_equal);
+    for (guint i = 0; i < ops->len; i++) {
+        ExiftoolReadOperation *op = g_ptr_array_index(ops, i);
+        g_hash_table_insert(op_by_path, op->file_path, op);
+    }
+
+    if (exiftool_ok && json_buf) {
+        // One forward pass over the whole array; each record is routed to
+        // its operation by SourceFile.
+        GPtrArray *records = exiftool_json_parse(json_buf);
+        for (guint i = 0; i < records->len; i++) {
+            ExiftoolJsonRecord *rec = g_ptr_array_index(records, i);
+            if (!rec->source_file) continue;
+
+            ExiftoolReadOperation *op = g_hash_table_lookup(op_by_path, rec->source_file);
+            if (op) {
+                g_hash_table_remove(op_by_path, rec->source_file);
+                trace_log(TRACE_METADATA_READ, "tags for %s: title=%s year=%s category=%s",
+                          op->file_path,
+                          rec->title ? rec->title : "(none)",
+                          rec->year ? rec->year : "(none)",
+                          rec->category ? rec->category : "(none)");
+                pdf_entry_populate_metadata(op, rec->title, rec->year, rec->category,
+                                            rec->page_count ? atoi(rec->page_count) : 0);
+            }
+        }
+        g_ptr_array_free(records, TRUE);
+    }
+
+    // Anything still in the table got no JSON object (file unreadable, batch
+    // failed, ...). Apply the filename-derived fallback so rows never stay
+    // stuck on "Carregando título...".
+    GHashTableIter iter;
+    gpointer key, value;
+    g_hash_table_iter_init(&iter, op_by_path);
+    while (g_hash_table_iter_next(&iter, &key, &value)) {
+        exiftool_apply_metadata((ExiftoolReadOperation *)value, NULL, FALSE, error_text);
     }
+
+    g_hash_table_destroy(op_by_path);
 }
 
 /**
- * @brief Loads categories from 'config/categories.txt'.
+ * @brief Drain-done callback for a batched exiftool run. Dispatches records.
  */
-gboolean load_categories_from_file(const gchar *filepath) {
-    if (global_categories) {
-        for (gint i = 0; i < global_num_categories; i++) {
-            SAFE_FREE(global_categories[i]);
-        }
-        SAFE_FREE(global_categories);
-    }
-    global_num_categories = 0;
+static void exiftool_batch_drained(gint status, const gchar *stdout_buf, const gchar *stderr_buf, gpointer user_data) {
+    GPtrArray *ops = (GPtrArray *)user_data;
+    if (!ops) return;
 
-    GList *category_list = NULL;
-    gchar *line = NULL;
-    gsize len = 0;
-    gssize read;
-    FILE *fp = fopen(filepath, "r");
+    g_print("[Main Thread] Batched exiftool run finished with status: %d (%u files)\n",
+            status, ops->len);
 
-    if (!fp) {
-        g_warning("Could not open categories file '%s': %s", filepath, g_strerror(errno));
+    // Exiftool exits non-zero if any file in the batch failed; files that did
+    // parse still produce objects, so dispatch whatever output we got.
+    gboolean got_output = stdout_buf && *stdout_buf;
+    gint64 read_start = TRACE_BEGIN(TRACE_METADATA_READ);
+    exiftool_batch_dispatch(ops, stdout_buf, got_output, stderr_buf);
+    TRACE_END(TRACE_METADATA_READ, read_start);
+
+    g_ptr_array_free(ops, TRUE);
+}
+
+/**
+ * @brief Reads metadata for a whole folder's worth of PDFs in one process.
+ *
+ * Takes ownership of @ops (and the operations inside) on success. Returns
+ * FALSE without consuming anything if the process could not be spawned.
+ */
+gboolean exiftool_batch_read(GPtrArray *ops) {
+    if (!ops || ops->len == 0) return FALSE;
+
+    GPtrArray *argv = g_ptr_array_new();
+    g_ptr_array_add(argv, (gchar*)"exiftool");
+    g_ptr_array_add(argv, (gchar*)"-j");
+    g_ptr_array_add(argv, (gchar*)"-Title");
+    g_ptr_array_add(argv, (gchar*)"-Year");
+    g_ptr_array_add(argv, (gchar*)"-Category");
+    g_ptr_array_add(argv, (gchar*)"-PageCount");
+    for (guint i = 0; i < ops->len; i++) {
+        ExiftoolReadOperation *op = g_ptr_array_index(ops, i);
+        g_ptr_array_add(argv, op->file_path);
+    }
+    g_ptr_array_add(argv, NULL);
+
+    GPid pid;
+    gint stdout_fd_local, stderr_fd_local;
+    GError *spawn_error = NULL;
+    gboolean spawned = g_spawn_async_with_pipes(NULL, (gchar**)argv->pdata, NULL,
+                                                G_SPAWN_SEARCH_PATH | G_SPAWN_DO_NOT_REAP_CHILD,
+                                                NULL, NULL, &pid, NULL,
+                                                &stdout_fd_local, &stderr_fd_local, &spawn_error);
+    g_ptr_array_free(argv, TRUE);
+
+    if (!spawned) {
+        g_warning("Failed to spawn batched exiftool process: %s", spawn_error ? spawn_error->message : "N/A");
+        if (spawn_error) g_error_free(spawn_error);
         return FALSE;
     }
 
-    while ((read = getline(&line, &len, fp)) != -1) {
-        line[strcspn(line, "\n")] = 0;
-        if (g_strcmp0(line, "") != 0) {
-            category_list = g_list_append(category_list, g_strdup(line));
-        }
+    trace_count(TRACE_COUNT_PROCESSES_SPAWNED, 1);
+    exiftool_spawn_watch_new(pid, stdout_fd_local, stderr_fd_local, exiftool_batch_drained, ops);
+    return TRUE;
+}
+
+/**
+ * @brief Callback for file selection. Updates entry and triggers async exiftool.
+ */
+void on_file_set(GtkFileChooserButton *button, GtkListBoxRow *row) {
+    g_print("File set callback triggered.\n");
+
+    PdfEntry *entry = g_object_get_data(G_OBJECT(row), "pdf-entry");
+    if (!entry) {
+        g_warning("PdfEntry data not found for the row. Cannot process file selection.");
+        return;
     }
-    fclose(fp);
-    SAFE_FREE(line);
 
-    global_num_categories = g_list_length(category_list);
-    if (global_num_categories == 0) {
-        g_warning("No categories found in '%s'. Please add categories, one per line.", filepath);
-        g_list_free_full(category_list, g_free);
-        return FALSE;
+    gchar *file_path = gtk_file_chooser_get_filename(GTK_FILE_CHOOSER(button));
+    if (!file_path) {
+        g_warning("No file path selected. Skipping processing.");
+        return;
     }
 
-    global_categories = g_new0(gchar*, global_num_categories + 1);
-    gint i = 0;
-    for (GList *l = category_list; l != NULL; l = l->next) {
-        global_categories[i++] = (gchar*)l->data;
+    if (!is_valid_path(file_path)) {
+        g_warning("Selected file path is invalid: %s", file_path);
+        SAFE_FREE(file_path);
+        return;
     }
-    global_categories[i] = NULL;
 
-    g_list_free(category_list);
+    g_print("  Selected file: %s\n", file_path);
 
-    g_print("Loaded %d categories from '%s'.\n", global_num_categories, filepath);
-    return TRUE;
+    category_stats_entry_removed(entry->category_index, entry);
+
+    entry->file_path = session_strdup(file_path);
+    SAFE_FREE(file_path);
+
+    GStatBuf selected_stat;
+    entry->file_size = (g_stat(entry->file_path, &selected_stat) == 0) ? (gint64)selected_stat.st_size : 0;
+    category_stats_entry_added(entry->category_index, entry);
+
+    pdf_entry_set_title(entry, "Carregando título...");
+    pdf_entry_set_year(entry, "Carregando ano...");
+    pdf_entry_set_category(entry, "Carregando categoria...");
+
+    gint category_index = entry->category_index;
+    if (category_index < 0 || category_index >= global_num_categories) {
+        category_index = -1;
+    }
+    if (category_index == -1) {
+        g_warning("Could not determine category index for the selected PDF. Exiftool processing might be affected.");
+    }
+
+    ExiftoolReadOperation *op = g_malloc0(sizeof(ExiftoolReadOperation));
+    op->file_path = g_strdup(entry->file_path);
+    op->entry = entry;
+    op->generation = pdf_load_generation;
+    op->category_index = category_index;
+    op->is_new_file_selection = TRUE;
+
+    pdf_load_track_queued();
+    if (!exiftool_daemon_submit(op) && !spawn_exiftool_read(op)) {
+        g_warning("Could not start exiftool for new file: %s", op->file_path);
+        pdf_load_track_finished(op->generation);
+        SAFE_FREE(op->file_path);
+        SAFE_FREE(op);
+    }
 }
 
+// Quiet period before a counter edit triggers the actual list re-sort
+#define PDF_SORT_DEBOUNCE_MS 200
+
 /**
- * @brief Loads professor names from 'config/professores.txt'.
+ * @brief Idle callback that performs a coalesced list box re-sort.
  */
-gboolean load_professors_from_file(const gchar *filepath) {
-    gtk_combo_box_text_remove_all(GTK_COMBO_BOX_TEXT(professor_combo));
+static gboolean list_box_deferred_sort_cb(gpointer user_data) {
+    GtkListBox *list_box = GTK_LIST_BOX(user_data);
+    g_object_set_data(G_OBJECT(list_box), "pending-sort-id", GUINT_TO_POINTER(0));
+    // The source's reference keeps the list box alive past a
+    // gtk_widget_destroy; just skip the sort when it fires in that window.
+    if (!gtk_widget_in_destruction(GTK_WIDGET(list_box))) {
+        gtk_list_box_invalidate_sort(list_box);
+    }
+    return G_SOURCE_REMOVE;
+}
 
-    FILE *fp = fopen(filepath, "r");
-    if(fp) {
-        char line[256];
-        while(fgets(line, sizeof(line), fp)) {
-            line[strcspn(line, "\n")] = 0;
-            if (g_strcmp0(line, "") != 0) {
-                gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(professor_combo), line);
+/**
+ * @brief Schedules a single debounced re-sort for a list box.
+ *
+ * Keystroke-driven edits land here instead of calling invalidate_sort
+ * directly; the actual O(n log n) re-sort runs once, at idle priority, after
+ * the edits pause, so typing latency stays flat regardless of category size.
+ */
+void list_box_schedule_sort(GtkListBox *list_box) {
+    guint source_id = GPOINTER_TO_UINT(g_object_get_data(G_OBJECT(list_box), "pending-sort-id"));
+    if (source_id != 0) {
+        g_source_remove(source_id);
+    }
+    // The source owns a reference: tearing the section down inside the
+    // debounce window must not leave the callback a dangling pointer.
+    source_id = g_timeout_add_full(G_PRIORITY_DEFAULT_IDLE, PDF_SORT_DEBOUNCE_MS,
+                                   list_box_deferred_sort_cb, g_object_ref(list_box),
+                                   (GDestroyNotify)g_object_unref);
+    g_object_set_data(G_OBJECT(list_box), "pending-sort-id", GUINT_TO_POINTER(source_id));
+}
+
+/**
+ * @brief Callback for counter entry changes. Updates internal value and re-sorts list.
+ */
+void on_counter_entry_changed(GtkEditable *editable, PdfEntry *entry) {
+    const gchar *text = gtk_entry_get_text(GTK_ENTRY(editable));
+    gint new_val = atoi(text);
+    if (new_val < 0) new_val = 0;
+
+    if (entry->current_counter_value != new_val) {
+        entry->current_counter_value = new_val;
+
+        GtkWidget *parent_row = gtk_widget_get_parent(entry->box);
+        if (parent_row && GTK_IS_LIST_BOX_ROW(parent_row)) {
+            GtkWidget *list_box = gtk_widget_get_parent(parent_row);
+            if (list_box && GTK_IS_LIST_BOX(list_box)) {
+                list_box_schedule_sort(GTK_LIST_BOX(list_box));
             }
         }
-        fclose(fp);
-        return TRUE;
-    } else {
-        g_warning("Could not open 'config/professores.txt'. Please ensure the file exists.");
-        gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(professor_combo), "Nenhum Professor Disponível");
-        return FALSE;
     }
 }
 
 /**
- * @brief Saves professor list from config dialog and creates directories.
+ * @brief Callback for category entry changes. Updates internal category string.
  */
-void save_professors_list(GtkWidget *button, gpointer user_data) {
-    (void)button;
+void on_category_entry_changed(GtkEditable *editable, PdfEntry *entry) {
+    const gchar *new_category = gtk_entry_get_text(GTK_ENTRY(editable));
+    g_print("Category changed for %s to: %s\n", entry->file_path ? entry->file_path : "N/A", new_category);
+    entry->original_category = session_intern(new_category);
+}
+
+/**
+ * @brief Compares PdfEntries by their current_counter_value for sorting.
+ */
+gint compare_pdf_entries_by_counter(GtkListBoxRow *row1, GtkListBoxRow *row2, gpointer user_data) {
     (void)user_data;
 
-    GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(professors_text_view));
-    GtkTextIter start, end;
-    gtk_text_buffer_get_start_iter(buffer, &start);
-    gtk_text_buffer_get_end_iter(buffer, &end);
-    gchar *content = gtk_text_buffer_get_text(buffer, &start, &end, FALSE);
+    PdfEntry *entry_a = g_object_get_data(G_OBJECT(row1), "pdf-entry");
+    PdfEntry *entry_b = g_object_get_data(G_OBJECT(row2), "pdf-entry");
 
-    GError *error = NULL;
-    if (g_file_set_contents("config/professores.txt", content, -1, &error)) {
-        g_print("Professors list saved. Now creating directories...\n");
-        gchar *professor_base_dir = g_strdup("./");
+    if (!entry_a || !entry_b) return 0;
 
-        gchar **professors_array = g_strsplit(content, "\n", 0);
-        for (gint p_idx = 0; professors_array[p_idx] != NULL; p_idx++) {
-            gchar *professor_name = g_strstrip(professors_array[p_idx]);
-            if (g_strcmp0(professor_name, "") == 0) continue;
+    gint counter_a = entry_a->current_counter_value;
+    gint counter_b = entry_b->current_counter_value;
 
-            g_print("  Processing professor: %s\n", professor_name);
+    return counter_a - counter_b;
+}
 
-            gchar *professor_folder_path = g_strdup_printf("%s%s", professor_base_dir, professor_name);
-            if (!g_mkdir_with_parents(professor_folder_path, 0755)) {
-                if (errno != EEXIST) {
-                    g_warning("    Failed to create professor directory '%s': %s", professor_folder_path, g_strerror(errno));
-                } else {
-                    g_print("    Professor directory already exists: %s\n", professor_folder_path);
-                }
-            } else {
-                g_print("    Professor directory created: %s\n", professor_folder_path);
-            }
+/**
+ * @brief Frees dynamically allocated memory within a PdfEntry struct.
+ */
+void pdf_entry_destroy_notify(gpointer data) {
+    PdfEntry *entry = (PdfEntry *)data;
+    if (entry) {
+        g_print("Freeing PdfEntry data for: %s (GDestroyNotify)\n", entry->file_path ? entry->file_path : "N/A");
+        SAFE_FREE(entry->title_text);
+        SAFE_FREE(entry->year_text);
+        SAFE_FREE(entry->category_text);
+        SAFE_FREE(entry->counter_text);
+        // file_path and the original_* fields live in the session arena;
+        // they are released wholesale by session_arena_reset().
+        SAFE_FREE(entry);
+    }
+}
 
-            for (gint c_idx = 0; c_idx < global_num_categories; c_idx++) {
-                if (c_idx < 0 || c_idx >= global_num_categories || !global_categories[c_idx]) {
-                    g_warning("Invalid category index or NULL category name during directory creation for professor '%s'. Skipping.", professor_name);
-                    continue;
-                }
-                gchar *category_folder_path = g_strdup_printf("%s/%s", professor_folder_path, global_categories[c_idx]);
-                if (!g_mkdir_with_parents(category_folder_path, 0755)) {
-                    if (errno != EEXIST) {
-                        g_warning("      Failed to create category directory '%s' for '%s': %s",
-                                  global_categories[c_idx], professor_name, g_strerror(errno));
-                    } else {
-                        g_print("      Category directory already exists: %s\n", category_folder_path);
-                    }
-                } else {
-                    g_print("      Category directory created: %s\n", category_folder_path);
-                }
-                SAFE_FREE(category_folder_path);
+/**
+ * @brief Sanitizes a string for use as a filename.
+ */
+gchar* sanitize_filename(const gchar *input) {
+    if (!input || *input == '\0') return g_strdup("documento_sem_titulo");
+
+    // Single forward pass into one buffer: replacement writes a one-byte '_'
+    // over a character of at least one byte and collapsing only drops bytes,
+    // so the output never outgrows the input.
+    gsize input_len = strlen(input);
+    gchar *result = g_malloc(input_len + 1);
+    gchar *out = result;
+    gboolean last_was_underscore = FALSE;
+
+    for (const gchar *p = input; *p; p = g_utf8_next_char(p)) {
+        gunichar c = g_utf8_get_char(p);
+        gboolean replace = (c == '/' || c == '\\' || c == ':' || c == '*' ||
+                            c == '?' || c == '\"' || c == '<' || c == '>' ||
+                            c == '|' || g_unichar_isspace(c));
+        if (replace || c == '_') {
+            if (!last_was_underscore) {
+                *out++ = '_';
             }
-            SAFE_FREE(professor_folder_path);
+            last_was_underscore = TRUE;
+        } else {
+            gsize char_len = (gsize)(g_utf8_next_char(p) - p);
+            memcpy(out, p, char_len);
+            out += char_len;
+            last_was_underscore = FALSE;
         }
-        g_strfreev(professors_array);
-        SAFE_FREE(professor_base_dir);
+    }
+    *out = '\0';
 
-        GtkWidget *dialog = gtk_message_dialog_new(NULL, GTK_DIALOG_MODAL, GTK_MESSAGE_INFO, GTK_BUTTONS_OK, "Lista de professores salva com sucesso!");
-        gtk_dialog_run(GTK_DIALOG(dialog));
-        gtk_widget_destroy(dialog);
-        refresh_professor_combo();
-    } else {
-        GtkWidget *dialog = gtk_message_dialog_new(NULL, GTK_DIALOG_MODAL, GTK_MESSAGE_ERROR, GTK_BUTTONS_OK, "Erro ao salvar lista de professores: %s", error ? error->message : "N/A");
-        gtk_dialog_run(GTK_DIALOG(dialog));
-        gtk_widget_destroy(dialog);
-        if (error) g_error_free(error);
+    if (out == result) {
+        SAFE_FREE(result);
+        return g_strdup("documento_sem_titulo");
     }
-    SAFE_FREE(content);
+
+    return result;
 }
 
 /**
- * @brief Saves category list from config dialog.
+ * @brief Creates and initializes a new PdfEntry struct.
  */
-void save_categories_list(GtkWidget *button, gpointer user_data) {
-    (void)button;
-    (void)user_data;
+PdfEntry* create_pdf_entry() {
+    PdfEntry *entry = g_new0(PdfEntry, 1);
+    entry->row = NULL;
+    entry->title_text = NULL;
+    entry->year_text = NULL;
+    entry->category_text = NULL;
+    entry->counter_text = NULL;
+    entry->file_path = NULL;
+    entry->original_title = NULL;
+    entry->original_year = NULL;
+    entry->original_category = NULL;
+    entry->original_filename_no_ext = NULL;
+    entry->has_original_counter = FALSE;
+    entry->original_detected_counter = 0;
+    entry->current_counter_value = 0;
+    return entry;
+}
 
-    GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(categories_text_view));
-    GtkTextIter start, end;
-    gtk_text_buffer_get_start_iter(buffer, &start);
-    gtk_text_buffer_get_end_iter(buffer, &end);
-    gchar *content = gtk_text_buffer_get_text(buffer, &start, &end, FALSE);
+/**
+ * @brief Model/widget accessors for a PdfEntry's editable fields.
+ *
+ * While a row widget exists it is the live store (the user may be typing in
+ * it); before materialization the *_text model fields are. Setters keep both
+ * in sync so values survive materialization and teardown.
+ */
+const gchar* pdf_entry_get_title(PdfEntry *entry) {
+    if (entry->title_entry) return gtk_entry_get_text(GTK_ENTRY(entry->title_entry));
+    return entry->title_text ? entry->title_text : "";
+}
 
-    GError *error = NULL;
-    if (g_file_set_contents("config/categories.txt", content, -1, &error)) {
-        GtkWidget *dialog = gtk_message_dialog_new(NULL, GTK_DIALOG_MODAL, GTK_MESSAGE_INFO, GTK_BUTTONS_OK, "Lista de categorias salva com sucesso!");
-        gtk_dialog_run(GTK_DIALOG(dialog));
-        gtk_widget_destroy(dialog);
-        refresh_category_gui();
-    } else {
-        GtkWidget *dialog = gtk_message_dialog_new(NULL, GTK_DIALOG_MODAL, GTK_MESSAGE_ERROR, GTK_BUTTONS_OK, "Erro ao salvar lista de categorias: %s", error ? error->message : "N/A");
-        gtk_dialog_run(GTK_DIALOG(dialog));
-        gtk_widget_destroy(dialog);
-        if (error) g_error_free(error);
-    }
-    SAFE_FREE(content);
+const gchar* pdf_entry_get_year(PdfEntry *entry) {
+    if (entry->year_entry) return gtk_entry_get_text(GTK_ENTRY(entry->year_entry));
+    return entry->year_text ? entry->year_text : "";
 }
 
-// =============================================================================
-// GUI MANAGEMENT FUNCTIONS
-// =============================================================================
+const gchar* pdf_entry_get_category(PdfEntry *entry) {
+    if (entry->category_entry) return gtk_entry_get_text(GTK_ENTRY(entry->category_entry));
+    return entry->category_text ? entry->category_text : "";
+}
 
-/**
- * @brief Cleans up all existing category GUI elements.
- */
-void cleanup_category_gui() {
-    if (global_sections) {
-        for (gint i = 0; i < global_num_categories; i++) {
-            if (global_sections[i].frame) {
-                gtk_widget_destroy(global_sections[i].frame);
-            }
-            if (global_sections[i].entries) {
-                g_list_free(global_sections[i].entries);
-                global_sections[i].entries = NULL;
-            }
-        }
-        SAFE_FREE(global_sections);
-    }
+const gchar* pdf_entry_get_counter(PdfEntry *entry) {
+    if (entry->counter_entry) return gtk_entry_get_text(GTK_ENTRY(entry->counter_entry));
+    return entry->counter_text ? entry->counter_text : "";
+}
 
-    if (category_content_vbox) {
-        GList *children = gtk_container_get_children(GTK_CONTAINER(category_content_vbox));
-        for (GList *l = children; l != NULL; l = g_list_next(l)) {
-            gtk_widget_destroy(GTK_WIDGET(l->data));
-        }
-        g_list_free(children);
-    }
+void pdf_entry_set_title(PdfEntry *entry, const gchar *text) {
+    SAFE_FREE(entry->title_text);
+    entry->title_text = g_strdup(text ? text : "");
+    if (entry->title_entry) gtk_entry_set_text(GTK_ENTRY(entry->title_entry), entry->title_text);
+}
 
-    if (category_nav_list_box) {
-        GList *children = gtk_container_get_children(GTK_CONTAINER(category_nav_list_box));
-        for (GList *l = children; l != NULL; l = l->next) {
-            gtk_widget_destroy(GTK_WIDGET(l->data));
-        }
-        g_list_free(children);
-    }
+void pdf_entry_set_year(PdfEntry *entry, const gchar *text) {
+    SAFE_FREE(entry->year_text);
+    entry->year_text = g_strdup(text ? text : "");
+    if (entry->year_entry) gtk_entry_set_text(GTK_ENTRY(entry->year_entry), entry->year_text);
+}
+
+void pdf_entry_set_category(PdfEntry *entry, const gchar *text) {
+    SAFE_FREE(entry->category_text);
+    entry->category_text = g_strdup(text ? text : "");
+    if (entry->category_entry) gtk_entry_set_text(GTK_ENTRY(entry->category_entry), entry->category_text);
+}
+
+void pdf_entry_set_counter(PdfEntry *entry, const gchar *text) {
+    SAFE_FREE(entry->counter_text);
+    entry->counter_text = g_strdup(text ? text : "");
+    if (entry->counter_entry) gtk_entry_set_text(GTK_ENTRY(entry->counter_entry), entry->counter_text);
 }
 
 /**
- * @brief Creates and populates category GUI elements.
+ * @brief Creates a GtkListBoxRow with widgets for a PdfEntry.
+ *
+ * Widgets are initialized from the entry's model fields, so a row can be
+ * materialized at any time after the data has been loaded.
  */
-void create_category_gui(GtkWidget *nav_list_box, GtkWidget *content_vbox) {
-    global_sections = g_new0(CategorySection, global_num_categories);
+GtkListBoxRow* create_pdf_entry_row(PdfEntry *entry, gint category_index) {
+    (void)category_index;
 
-    for(gint i = 0; i < global_num_categories; i++) {
-        global_sections[i].frame = gtk_frame_new(global_categories[i]);
-        GtkWidget *box = gtk_box_new(GTK_ORIENTATION_VERTICAL, 5);
-
-        global_sections[i].list = gtk_list_box_new();
-        gtk_list_box_set_selection_mode(GTK_LIST_BOX(global_sections[i].list), GTK_SELECTION_NONE);
-        gtk_widget_set_hexpand(GTK_WIDGET(global_sections[i].list), TRUE);
-        gtk_widget_set_halign(GTK_WIDGET(global_sections[i].list), GTK_ALIGN_FILL);
-
-        GtkWidget *buttons_hbox = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 5);
-        gtk_widget_set_halign(buttons_hbox, GTK_ALIGN_END);
-
-        global_sections[i].add_btn = gtk_button_new_with_label("Adicionar PDF");
-        g_signal_connect(global_sections[i].add_btn, "clicked", G_CALLBACK(add_pdf_entry), &global_sections[i]);
-        gtk_box_pack_end(GTK_BOX(buttons_hbox), global_sections[i].add_btn, FALSE, FALSE, 0);
-
-        GtkWidget *open_folder_btn = gtk_button_new_with_label("Abrir Pasta");
-        g_signal_connect(open_folder_btn, "clicked", G_CALLBACK(on_open_category_folder), GINT_TO_POINTER(i));
-        gtk_box_pack_end(GTK_BOX(buttons_hbox), open_folder_btn, FALSE, FALSE, 0);
-
-        GtkWidget *list_scrolled_window = gtk_scrolled_window_new(NULL, NULL);
-        gtk_scrolled_window_set_policy(GTK_SCROLLED_WINDOW(list_scrolled_window),
-                                       GTK_POLICY_AUTOMATIC, GTK_POLICY_AUTOMATIC);
-        gtk_widget_set_hexpand(list_scrolled_window, TRUE);
-        gtk_widget_set_halign(list_scrolled_window, GTK_ALIGN_FILL);
-        gtk_widget_set_size_request(list_scrolled_window, -1, 300);
-        gtk_container_add(GTK_CONTAINER(list_scrolled_window), global_sections[i].list);
-
-        gtk_box_pack_start(GTK_BOX(box), list_scrolled_window, TRUE, TRUE, 0);
-        gtk_box_pack_start(GTK_BOX(box), buttons_hbox, FALSE, FALSE, 0);
-        gtk_container_add(GTK_CONTAINER(global_sections[i].frame), box);
-
-        gtk_box_pack_start(GTK_BOX(content_vbox), global_sections[i].frame, TRUE, TRUE, 30);
-        gtk_widget_set_hexpand(GTK_WIDGET(global_sections[i].frame), TRUE);
-        gtk_widget_set_halign(GTK_WIDGET(global_sections[i].frame), GTK_ALIGN_FILL);
-        gtk_widget_set_vexpand(GTK_WIDGET(global_sections[i].frame), TRUE);
+    GtkListBoxRow *row = GTK_LIST_BOX_ROW(gtk_list_box_row_new());
+    entry->row = row;
+    entry->box = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 5);
 
-        GtkWidget *shortcut_btn = gtk_button_new_with_label(global_categories[i]);
-        g_object_set_data(G_OBJECT(shortcut_btn), "category-frame", global_sections[i].frame);
-        g_signal_connect(shortcut_btn, "clicked", G_CALLBACK(on_category_shortcut_clicked), NULL);
+    g_object_set_data_full(G_OBJECT(row), "pdf-entry", entry, pdf_entry_destroy_notify);
 
-        GtkWidget *row = gtk_list_box_row_new();
-        gtk_container_add(GTK_CONTAINER(row), shortcut_btn);
-        gtk_list_box_insert(GTK_LIST_BOX(nav_list_box), GTK_WIDGET(row), -1);
+    entry->file_btn = gtk_file_chooser_button_new("Selecionar PDF", GTK_FILE_CHOOSER_ACTION_OPEN);
+    gtk_widget_set_size_request(entry->file_btn, 150, -1);
+    gtk_box_pack_start(GTK_BOX(entry->box), entry->file_btn, FALSE, FALSE, 0);
+    g_signal_connect(G_OBJECT(entry->file_btn), "file-set", G_CALLBACK(on_file_set), row);
+    if (entry->file_path) {
+        gtk_file_chooser_set_filename(GTK_FILE_CHOOSER(entry->file_btn), entry->file_path);
     }
-    gtk_widget_show_all(nav_list_box);
-    gtk_widget_show_all(content_vbox);
+
+    entry->counter_entry = gtk_entry_new();
+    gtk_entry_set_width_chars(GTK_ENTRY(entry->counter_entry), 3);
+    gtk_entry_set_max_length(GTK_ENTRY(entry->counter_entry), 2);
+    gtk_entry_set_placeholder_text(GTK_ENTRY(entry->counter_entry), "NN");
+    if (entry->counter_text) gtk_entry_set_text(GTK_ENTRY(entry->counter_entry), entry->counter_text);
+    gtk_box_pack_start(GTK_BOX(entry->box), entry->counter_entry, FALSE, FALSE, 5);
+    g_signal_connect(G_OBJECT(entry->counter_entry), "changed", G_CALLBACK(on_counter_entry_changed), entry);
+
+    entry->title_entry = gtk_entry_new();
+    gtk_entry_set_placeholder_text(GTK_ENTRY(entry->title_entry), "Título do PDF");
+    if (entry->title_text) gtk_entry_set_text(GTK_ENTRY(entry->title_entry), entry->title_text);
+    gtk_widget_set_hexpand(entry->title_entry, TRUE);
+    gtk_box_pack_start(GTK_BOX(entry->box), entry->title_entry, TRUE, TRUE, 0);
+
+    entry->year_entry = gtk_entry_new();
+    gtk_entry_set_width_chars(GTK_ENTRY(entry->year_entry), 5);
+    gtk_entry_set_max_length(GTK_ENTRY(entry->year_entry), 4);
+    gtk_entry_set_placeholder_text(GTK_ENTRY(entry->year_entry), "Ano");
+    if (entry->year_text) gtk_entry_set_text(GTK_ENTRY(entry->year_entry), entry->year_text);
+    gtk_box_pack_start(GTK_BOX(entry->box), entry->year_entry, FALSE, FALSE, 5);
+
+    entry->category_entry = gtk_entry_new();
+    gtk_entry_set_width_chars(GTK_ENTRY(entry->category_entry), 15);
+    gtk_entry_set_placeholder_text(GTK_ENTRY(entry->category_entry), "Categoria (ex: artigo)");
+    if (entry->category_text) gtk_entry_set_text(GTK_ENTRY(entry->category_entry), entry->category_text);
+    gtk_box_pack_start(GTK_BOX(entry->box), entry->category_entry, FALSE, FALSE, 5);
+    g_signal_connect(G_OBJECT(entry->category_entry), "changed", G_CALLBACK(on_category_entry_changed), entry);
+
+    entry->preview_btn = gtk_button_new_with_label("Visualizar");
+    gtk_box_pack_start(GTK_BOX(entry->box), entry->preview_btn, FALSE, FALSE, 5);
+    g_signal_connect(G_OBJECT(entry->preview_btn), "clicked", G_CALLBACK(on_preview_pdf), entry);
+
+    entry->remove_btn = gtk_button_new_with_label("Remover");
+    gtk_box_pack_start(GTK_BOX(entry->box), entry->remove_btn, FALSE, FALSE, 0);
+    g_signal_connect(G_OBJECT(entry->remove_btn), "clicked", G_CALLBACK(on_remove_pdf_entry), entry);
+
+    gtk_container_add(GTK_CONTAINER(row), entry->box);
+    gtk_widget_show_all(entry->box);
+
+    return row;
 }
 
 /**
- * @brief Refreshes the category GUI after config changes.
+ * @brief Adds a PdfEntry to its category's entry list (and GUI, if given).
+ *
+ * With @row NULL the entry is only registered in the data model and queued
+ * for lazy row materialization.
  */
-void refresh_category_gui() {
-    g_print("Refreshing category GUI...\n");
-    cleanup_category_gui();
-    if (load_categories_from_file("config/categories.txt")) {
-        create_category_gui(category_nav_list_box, category_content_vbox);
+// =============================================================================
+// INCREMENTAL CATEGORY STATISTICS
+// =============================================================================
+
+/**
+ * @brief Refreshes one section's frame label with its live statistics.
+ */
+void category_stats_update_label(gint category_index) {
+    if (category_index < 0 || category_index >= global_num_categories) return;
+    if (!global_sections || !global_sections[category_index].frame) return;
+
+    guint count = global_sections[category_index].entries ? global_sections[category_index].entries->len : 0;
+    gchar *label;
+    if (count == 0) {
+        label = g_strdup(global_categories[category_index]);
     } else {
-        g_warning("Failed to refresh categories after loading from file.");
+        gint64 bytes = global_category_total_bytes ? global_category_total_bytes[category_index] : 0;
+        label = g_strdup_printf("%s  —  %u PDF(s), %.1f MB",
+                                global_categories[category_index], count,
+                                bytes / (1024.0 * 1024.0));
     }
-    gtk_combo_box_set_active_id(GTK_COMBO_BOX(professor_combo), NULL);
+    gtk_frame_set_label(GTK_FRAME(global_sections[category_index].frame), label);
+    SAFE_FREE(label);
 }
 
 /**
- * @brief Refreshes the professor combo box after config changes.
+ * @brief Statistics hook for an entry entering the model.
  */
-void refresh_professor_combo() {
-    g_print("Refreshing professor combo...\n");
-    if (!load_professors_from_file("config/professores.txt")) {
-        g_warning("Failed to refresh professors after loading from file.");
+void category_stats_entry_added(gint category_index, PdfEntry *entry) {
+    if (category_index < 0 || category_index >= global_num_categories) return;
+    if (global_category_total_bytes) {
+        global_category_total_bytes[category_index] += entry->file_size;
     }
-    gtk_combo_box_set_active_id(GTK_COMBO_BOX(professor_combo), NULL);
+    category_stats_update_label(category_index);
 }
 
 /**
- * @brief Adds a new, blank PdfEntry to the GUI.
+ * @brief Statistics hook for an entry leaving the model.
  */
-void add_pdf_entry(GtkWidget *widget, CategorySection *section) {
-    (void)widget;
+void category_stats_entry_removed(gint category_index, PdfEntry *entry) {
+    if (category_index < 0 || category_index >= global_num_categories) return;
+    if (global_category_total_bytes) {
+        global_category_total_bytes[category_index] -= entry->file_size;
+        if (global_category_total_bytes[category_index] < 0) {
+            global_category_total_bytes[category_index] = 0;
+        }
+    }
+    category_stats_update_label(category_index);
+}
 
-    const gchar *professor = gtk_combo_box_text_get_active_text(GTK_COMBO_BOX_TEXT(professor_combo));
+/**
+ * @brief Zeroes all statistics and restores the plain frame labels.
+ */
+void category_stats_reset(void) {
+    for (gint i = 0; i < global_num_categories; i++) {
+        if (global_category_total_bytes) {
+            global_category_total_bytes[i] = 0;
+        }
+        category_stats_update_label(i);
+    }
+}
 
-    if (!professor || g_strcmp0(professor, "") == 0) {
+/**
+ * @brief Exports the loaded entries as the CSV contar_categoryv3.sh produces.
+ *
+ * One "Professor,PDF_File,Categories,CategoryAlias" row per entry, written
+ * straight from the in-memory model: zero subprocesses, zero re-scans.
+ * Aliases come from config/categories_to_count.txt (same "name,'alias'"
+ * format the script reads) when that file exists; otherwise the entry's own
+ * category text is used for both columns.
+ */
+void export_category_statistics(GtkWidget *button, gpointer user_data) {
+    (void)button;
+    (void)user_data;
+
+    gchar *professor = gtk_combo_box_text_get_active_text(GTK_COMBO_BOX_TEXT(professor_combo));
+    if (!professor) {
         GtkWidget *dialog = gtk_message_dialog_new(NULL,
                                                    GTK_DIALOG_MODAL,
                                                    GTK_MESSAGE_ERROR,
                                                    GTK_BUTTONS_OK,
-                                                   "Por favor, selecione um professor antes de adicionar um PDF.");
+                                                   "Por favor, selecione um professor.");
         gtk_dialog_run(GTK_DIALOG(dialog));
         gtk_widget_destroy(dialog);
         return;
     }
 
-    PdfEntry *entry = create_pdf_entry();
-    entry->has_original_counter = FALSE;
-    entry->original_detected_counter = 0;
-    entry->current_counter_value = 0;
-    entry->original_filename_no_ext = g_strdup("");
-    entry->original_category = g_strdup(global_categories[section - global_sections]);
-
-    GtkListBoxRow *row = create_pdf_entry_row(entry, section - global_sections);
+    // Optional alias table, one "category,'alias'" pair per line
+    GPtrArray *alias_names = g_ptr_array_new_with_free_func(g_free);
+    GPtrArray *alias_values = g_ptr_array_new_with_free_func(g_free);
+    gchar *alias_content = NULL;
+    if (g_file_get_contents("config/categories_to_count.txt", &alias_content, NULL, NULL)) {
+        gchar **lines = g_strsplit(alias_content, "\n", -1);
+        for (gint i = 0; lines[i] != NULL; i++) {
+            gchar **parts = g_strsplit(lines[i], ",", 2);
+            gchar *name = parts[0] ? g_strstrip(parts[0]) : NULL;
+            if (name && *name != '\0') {
+                gchar *alias = parts[1] ? g_strstrip(parts[1]) : NULL;
+                if (alias) {
+                    // Strip the single quotes the script's format uses
+                    gsize alen = strlen(alias);
+                    if (alen >= 2 && alias[0] == '\'' && alias[alen - 1] == '\'') {
+                        alias[alen - 1] = '\0';
+                        alias++;
+                    }
+                }
+                g_ptr_array_add(alias_names, g_utf8_strdown(name, -1));
+                g_ptr_array_add(alias_values, g_strdup(alias && *alias != '\0' ? alias : name));
+            }
+            g_strfreev(parts);
+        }
+        g_strfreev(lines);
+        SAFE_FREE(alias_content);
+    }
 
-    add_pdf_entry_to_gui(section - global_sections, entry, row);
-}
+    GString *csv = g_string_new("Professor,PDF_File,Categories,CategoryAlias\n");
 
-/**
- * @brief Removes a PdfEntry from GUI and moves its file to 'old_files'.
- */
-void on_remove_pdf_entry(GtkWidget *button, PdfEntry *entry) {
-    (void)button;
+    for (gint i = 0; i < global_num_categories; i++) {
+        if (!global_sections || !global_sections[i].entries) continue;
+
+        for (guint j = 0; j < global_sections[i].entries->len; j++) {
+            PdfEntry *entry = g_ptr_array_index(global_sections[i].entries, j);
+            if (!entry->file_path) continue;
+
+            gchar *pdf_name = g_path_get_basename(entry->file_path);
+            const gchar *category_text = pdf_entry_get_category(entry);
+            gchar *category_lower = g_utf8_strdown(category_text ? category_text : "", -1);
+
+            GString *matched = g_string_new(NULL);
+            GString *matched_aliases = g_string_new(NULL);
+            for (guint a = 0; a < alias_names->len; a++) {
+                const gchar *name_lower = g_ptr_array_index(alias_names, a);
+                if (strstr(category_lower, name_lower) != NULL) {
+                    if (matched->len > 0) {
+                        g_string_append_c(matched, '|');
+                        g_string_append_c(matched_aliases, '|');
+                    }
+                    g_string_append(matched, name_lower);
+                    g_string_append(matched_aliases, g_ptr_array_index(alias_values, a));
+                }
+            }
 
-    g_print("Removing PDF entry: %s\n", entry->file_path ? entry->file_path : "N/A");
-
-    GtkWidget *row = NULL;
-    GtkWidget *list_box = NULL;
-    CategorySection *current_section = NULL;
-    gint category_index = -1;
-    const gchar *professor = NULL;
-
-    row = gtk_widget_get_parent(entry->box);
-    if (row && GTK_IS_LIST_BOX_ROW(row)) {
-        list_box = gtk_widget_get_parent(row);
-        if (list_box && GTK_IS_LIST_BOX(list_box)) {
-            for (gint i = 0; i < global_num_categories; i++) {
-                if (global_sections[i].list == list_box) {
-                    current_section = &global_sections[i];
-                    category_index = i;
-                    break;
-                }
+            if (matched->len > 0) {
+                g_string_append_printf(csv, "%s,\"%s\",\"%s\",\"%s\"\n",
+                                       professor, pdf_name, matched->str, matched_aliases->str);
+            } else if (alias_names->len == 0 && category_text && *category_text != '\0') {
+                g_string_append_printf(csv, "%s,\"%s\",\"%s\",\"%s\"\n",
+                                       professor, pdf_name, category_text, category_text);
+            } else {
+                g_string_append_printf(csv, "%s,\"%s\",\"NoCategory\",\"NoCategory\"\n",
+                                       professor, pdf_name);
             }
+
+            g_string_free(matched, TRUE);
+            g_string_free(matched_aliases, TRUE);
+            SAFE_FREE(category_lower);
+            SAFE_FREE(pdf_name);
         }
     }
 
-    professor = gtk_combo_box_text_get_active_text(GTK_COMBO_BOX_TEXT(professor_combo));
+    GError *write_error = NULL;
+    if (g_file_set_contents("report_data.csv", csv->str, -1, &write_error)) {
+        g_print("Category statistics exported to report_data.csv.\n");
+        gtk_label_set_text(GTK_LABEL(status_label), "Estatísticas exportadas para report_data.csv.");
+    } else {
+        g_warning("Failed to write report_data.csv: %s", write_error ? write_error->message : "N/A");
+        if (write_error) g_error_free(write_error);
+        gtk_label_set_text(GTK_LABEL(status_label), "Erro ao exportar estatísticas.");
+    }
 
-    if (professor && entry->file_path && is_valid_path(entry->file_path) && g_file_test(entry->file_path, G_FILE_TEST_EXISTS) && current_section) {
-        gchar *professor_base_dir = g_strdup("./");
-        gchar *dest_category_dir = g_strdup_printf("%s%s/%s", professor_base_dir, professor, global_categories[category_index]);
-        gchar *old_files_dir = g_strdup_printf("%s/old_files", dest_category_dir);
+    g_string_free(csv, TRUE);
+    g_ptr_array_free(alias_names, TRUE);
+    g_ptr_array_free(alias_values, TRUE);
+    SAFE_FREE(professor);
+}
 
-        g_print("  Attempting to ensure old_files directory for removal exists: %s\n", old_files_dir);
-        if (!g_mkdir_with_parents(old_files_dir, 0755)) {
-            if (errno != EEXIST) {
-                g_warning("Failed to create old_files directory for removal: %s (%s)", old_files_dir, g_strerror(errno));
-            } else {
-                g_print("  Old_files directory for removal already exists: %s\n", old_files_dir);
-            }
+void add_pdf_entry_to_gui(gint category_index, PdfEntry *entry, GtkListBoxRow *row) {
+    if (category_index >= 0 && category_index < global_num_categories) {
+        entry->category_index = category_index;
+        g_ptr_array_add(global_sections[category_index].entries, entry);
+        category_stats_entry_added(category_index, entry);
+        if (row) {
+            gtk_list_box_insert(GTK_LIST_BOX(global_sections[category_index].list), GTK_WIDGET(row), -1);
+            gtk_widget_show_all(GTK_WIDGET(row));
         } else {
-            g_print("  Old_files directory for removal created: %s\n", old_files_dir);
+            g_ptr_array_add(global_sections[category_index].unmaterialized, entry);
         }
+    } else {
+        g_warning("Invalid category index %d for adding PDF entry to GUI.", category_index);
+    }
+}
 
-        gchar *original_basename = g_path_get_basename(entry->file_path);
-        gchar *old_file_dest_path = g_strdup_printf("%s/%s", old_files_dir, original_basename);
-
-        g_print("  Moving original file from %s to %s due to 'Remover' button click.\n", entry->file_path, old_file_dest_path);
-
-        GError *move_error = NULL;
-        GFile *original_gfile_to_move = g_file_new_for_path(entry->file_path);
-        GFile *old_dest_gfile = g_file_new_for_path(old_file_dest_path);
+/**
+ * @brief Materializes up to @max_rows queued rows for one category section.
+ *
+ * Called once after a folder scan to fill the viewport and again from the
+ * section's scroll handler as the user approaches the bottom of the list, so
+ * widget construction cost is paid per screenful instead of per archive.
+ */
+void category_section_materialize_rows(gint category_index, guint max_rows) {
+    if (category_index < 0 || category_index >= global_num_categories) return;
 
-        if (!g_file_move(original_gfile_to_move, old_dest_gfile, G_FILE_COPY_OVERWRITE, NULL, NULL, NULL, &move_error)) {
-            g_warning("Failed to move original file from %s to %s on 'Remover' click: %s",
-                      entry->file_path, old_file_dest_path, move_error ? move_error->message : "N/A");
-            if (move_error) g_error_free(move_error);
-        } else {
-            g_print("  Original file successfully moved to old_files by 'Remover' button.\n");
-        }
+    CategorySection *section = &global_sections[category_index];
+    guint created = 0;
 
-        if (original_gfile_to_move) g_object_unref(original_gfile_to_move);
-        if (old_dest_gfile) g_object_unref(old_dest_gfile);
-        SAFE_FREE(original_basename);
-        SAFE_FREE(old_file_dest_path);
-        SAFE_FREE(old_files_dir);
-        SAFE_FREE(dest_category_dir);
-        SAFE_FREE(professor_base_dir);
-    } else {
-        if (!professor) {
-            g_warning("No professor selected. Cannot determine 'old_files' destination for removal. Skipping file move.");
-        } else if (!entry->file_path || !g_file_test(entry->file_path, G_FILE_TEST_EXISTS)) {
-            g_print("File %s does not exist or file_path is NULL. Skipping file move to old_files.\n", entry->file_path ? entry->file_path : "N/A");
-        } else if (!current_section) {
-            g_warning("Could not find parent CategorySection for the listbox. Skipping file move.");
-        }
-    }
+    while (created < section->unmaterialized->len && created < max_rows) {
+        PdfEntry *entry = g_ptr_array_index(section->unmaterialized, created);
 
-    if (current_section) {
-        current_section->entries = g_list_remove(current_section->entries, entry);
-        gtk_list_box_invalidate_sort(GTK_LIST_BOX(current_section->list));
+        GtkListBoxRow *row = create_pdf_entry_row(entry, category_index);
+        gtk_list_box_insert(GTK_LIST_BOX(section->list), GTK_WIDGET(row), -1);
+        gtk_widget_show_all(GTK_WIDGET(row));
+        created++;
     }
 
-    if (row) {
-        gtk_widget_destroy(GTK_WIDGET(row));
-        g_print("PDF entry removed from GUI. PdfEntry struct will be freed by GDestroyNotify.\n");
-    } else {
-        g_warning("GUI context (row) invalid for full GUI removal. PdfEntry struct will not be automatically freed by GTK.");
+    if (created > 0) {
+        g_ptr_array_remove_range(section->unmaterialized, 0, created);
+        gtk_list_box_invalidate_sort(GTK_LIST_BOX(section->list));
+        g_print("Materialized %u row(s) for category '%s' (%u still pending).\n",
+                created, global_categories[category_index], section->unmaterialized->len);
     }
 }
 
+#define PDF_ROWS_MATERIALIZE_CHUNK 40
+
 /**
- * @brief Callback for professor selection. Clears old entries, loads new.
+ * @brief Scroll handler: materializes the next chunk near the list bottom.
  */
-gboolean on_professor_selected(GtkComboBox *combo_box, gpointer user_data) {
+static void on_section_scroll_changed(GtkAdjustment *adjustment, gpointer user_data) {
     (void)user_data;
+    gint category_index = GPOINTER_TO_INT(g_object_get_data(G_OBJECT(adjustment), "category-index"));
+    gdouble value = gtk_adjustment_get_value(adjustment);
+    gdouble page_size = gtk_adjustment_get_page_size(adjustment);
+    gdouble upper = gtk_adjustment_get_upper(adjustment);
 
-    const gchar *professor = gtk_combo_box_text_get_active_text(GTK_COMBO_BOX_TEXT(combo_box));
-
-    if (preview_report_btn) {
-        gtk_widget_hide(preview_report_btn);
+    if (value + page_size >= upper - page_size) {
+        category_section_materialize_rows(category_index, PDF_ROWS_MATERIALIZE_CHUNK);
     }
+}
 
-    gtk_label_set_text(GTK_LABEL(status_label), "Carregando informações do professor...");
-    gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(progress_bar), 0.0);
-    gchar *progress_text_0 = g_strdup_printf("%d%%", 0);
-    gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progress_bar), progress_text_0);
-    SAFE_FREE(progress_text_0);
-    g_main_context_iteration(NULL, FALSE);
+// =============================================================================
+// INCREMENTAL CATEGORY FOLDER WATCHING
+// =============================================================================
 
-    for (gint i = 0; i < global_num_categories; i++) {
-        GList *children = gtk_container_get_children(GTK_CONTAINER(global_sections[i].list));
-        for (GList *l = children; l != NULL; l = g_list_next(l)) {
-            gtk_widget_destroy(GTK_WIDGET(l->data));
-        }
-        g_list_free(children);
+static GFileMonitor **category_monitors = NULL;   /* one per category, active professor only */
+static GHashTable *monitor_self_paths = NULL;     /* files this app wrote itself; events ignored */
 
-        if (global_sections[i].entries) {
-            g_list_free(global_sections[i].entries);
-            global_sections[i].entries = NULL;
-        }
+/**
+ * @brief Marks a path as written by this application.
+ *
+ * The save pipeline copies PDFs straight into the watched category folders;
+ * without this the monitors would re-import every file we just saved as a
+ * duplicate entry.
+ */
+void category_monitors_note_self_write(const gchar *path) {
+    if (!monitor_self_paths) {
+        monitor_self_paths = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
     }
+    g_hash_table_add(monitor_self_paths, g_strdup(path));
+}
 
-    SAFE_FREE(global_max_category_counters);
-    global_max_category_counters = g_new0(gint, global_num_categories);
-
-    if (!professor) {
-        g_print("No professor selected or selection cleared. All entries cleared.\n");
-        gtk_label_set_text(GTK_LABEL(status_label), "Pronto.");
-        gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(progress_bar), 0.0);
-        gchar *progress_text_0_again = g_strdup_printf("%d%%", 0);
-        gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progress_bar), progress_text_0_again);
-        SAFE_FREE(progress_text_0_again);
-        g_main_context_iteration(NULL, FALSE);
-        return G_SOURCE_REMOVE;
+/**
+ * @brief Imports one externally created PDF as a new entry row.
+ */
+static void category_monitor_import_pdf(gint category_index, const gchar *path) {
+    // Already tracked? (CREATED and CHANGES_DONE_HINT both land here.)
+    CategorySection *section = &global_sections[category_index];
+    for (guint i = 0; i < section->entries->len; i++) {
+        PdfEntry *existing = g_ptr_array_index(section->entries, i);
+        if (g_strcmp0(existing->file_path, path) == 0) {
+            return;
+        }
     }
 
-    gchar *exiftool_path = g_find_program_in_path("exiftool");
-    if (!exiftool_path) {
-        GtkWidget *dialog = gtk_message_dialog_new(NULL,
-                                                   GTK_DIALOG_MODAL,
-                                                   GTK_MESSAGE_ERROR,
-                                                   GTK_BUTTONS_OK,
-                                                   "Erro: O programa 'exiftool' não foi encontrado no seu PATH.\n"
-                                                   "Por favor, instale-o (sudo apt install libimage-exiftool-perl) e tente novamente.");
-        gtk_dialog_run(GTK_DIALOG(dialog));
-        gtk_widget_destroy(dialog);
-        gtk_label_set_text(GTK_LABEL(status_label), "Erro: exiftool não encontrado.");
-        gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(progress_bar), 0.0);
-        gchar *progress_text_error = g_strdup_printf("Erro!");
-        gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progress_bar), progress_text_error);
-        SAFE_FREE(progress_text_error);
-        g_main_context_iteration(NULL, FALSE);
-        SAFE_FREE(exiftool_path);
-        return G_SOURCE_REMOVE;
-    }
-    SAFE_FREE(exiftool_path);
+    g_print("Monitor: importing new PDF %s into category '%s'.\n", path, global_categories[category_index]);
 
-    g_print("Professor selected: %s. Initiating folder scan for all categories.\n", professor);
+    PdfEntry *new_entry = create_pdf_entry();
+    new_entry->file_path = session_strdup(path);
 
-    for (gint i = 0; i < global_num_categories; i++) {
-        gchar *professor_base_dir = g_strdup("./");
-        gchar *category_folder_path = g_strdup_printf("%s%s/%s", professor_base_dir, professor, global_categories[i]);
+    GStatBuf import_stat;
+    if (g_stat(path, &import_stat) == 0) {
+        new_entry->file_size = (gint64)import_stat.st_size;
+    }
 
-        process_pdf_folder(category_folder_path, i);
+    pdf_entry_set_title(new_entry, "Carregando título...");
+    pdf_entry_set_year(new_entry, "Carregando ano...");
+    pdf_entry_set_category(new_entry, "Carregando categoria...");
+    add_pdf_entry_to_gui(category_index, new_entry, NULL);
+    category_section_materialize_rows(category_index, PDF_ROWS_MATERIALIZE_CHUNK);
 
-        gtk_list_box_set_sort_func(GTK_LIST_BOX(global_sections[i].list), (GtkListBoxSortFunc)compare_pdf_entries_by_counter, NULL, NULL);
-        gtk_list_box_invalidate_sort(GTK_LIST_BOX(global_sections[i].list));
+    ExiftoolReadOperation *op = g_malloc0(sizeof(ExiftoolReadOperation));
+    op->file_path = g_strdup(path);
+    op->entry = new_entry;
+    op->generation = pdf_load_generation;
+    op->category_index = category_index;
+    op->is_new_file_selection = FALSE;
 
-        SAFE_FREE(category_folder_path);
-        SAFE_FREE(professor_base_dir);
+    GStatBuf file_stat;
+    if (g_stat(path, &file_stat) == 0) {
+        op->file_mtime = (gint64)file_stat.st_mtime;
     }
+    op->file_size = new_entry->file_size;
 
-    gtk_label_set_text(GTK_LABEL(status_label), "Carregamento iniciado. Aguardando metadados...");
-    gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(progress_bar), 0.05);
-    gchar *progress_text_5 = g_strdup_printf("%d%%", 5);
-    gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progress_bar), progress_text_5);
-    SAFE_FREE(progress_text_5);
-    g_main_context_iteration(NULL, FALSE);
-
-    return G_SOURCE_REMOVE;
+    pdf_load_track_queued();
+    if (!exiftool_daemon_submit(op) && !spawn_exiftool_read(op)) {
+        g_warning("Could not start exiftool for %s", op->file_path);
+        pdf_load_track_finished(op->generation);
+        SAFE_FREE(op->file_path);
+        SAFE_FREE(op);
+    }
 }
 
 /**
- * @brief Opens the selected category folder in the system file manager.
+ * @brief Drops the entry (and row, if materialized) tracking a deleted file.
  */
-void on_open_category_folder(GtkWidget *button, gint category_index) {
-    (void)button;
+static void category_monitor_drop_pdf(gint category_index, const gchar *path) {
+    CategorySection *section = &global_sections[category_index];
 
-    const gchar *professor = gtk_combo_box_text_get_active_text(GTK_COMBO_BOX_TEXT(professor_combo));
-    if (!professor || g_strcmp0(professor, "") == 0) {
-        GtkWidget *dialog = gtk_message_dialog_new(NULL,
-                                                   GTK_DIALOG_MODAL,
-                                                   GTK_MESSAGE_ERROR,
-                                                   GTK_BUTTONS_OK,
-                                                   "Por favor, selecione um professor para abrir a pasta da categoria.");
-        gtk_dialog_run(GTK_DIALOG(dialog));
-        gtk_widget_destroy(dialog);
-        return;
-    }
+    for (guint i = 0; i < section->entries->len; i++) {
+        PdfEntry *entry = g_ptr_array_index(section->entries, i);
+        if (g_strcmp0(entry->file_path, path) != 0) continue;
 
-    if (category_index < 0 || category_index >= global_num_categories || !global_categories[category_index]) {
-        g_warning("Invalid category index provided to on_open_category_folder: %d", category_index);
-        GtkWidget *dialog = gtk_message_dialog_new(NULL,
-                                                   GTK_DIALOG_MODAL,
-                                                   GTK_MESSAGE_ERROR,
-                                                   GTK_BUTTONS_OK,
-                                                   "Erro interno: Categoria inválida para abrir a pasta.");
-        gtk_dialog_run(GTK_DIALOG(dialog));
-        gtk_widget_destroy(dialog);
+        g_print("Monitor: file %s disappeared; removing its entry.\n", path);
+        g_ptr_array_remove_index(section->entries, i);
+        g_ptr_array_remove(section->unmaterialized, entry);
+        category_stats_entry_removed(category_index, entry);
+
+        if (entry->row) {
+            // The row's GDestroyNotify frees the PdfEntry.
+            gtk_widget_destroy(GTK_WIDGET(entry->row));
+        } else {
+            pdf_entry_destroy_notify(entry);
+        }
         return;
     }
+}
 
-    gchar *professor_base_dir = g_strdup("./");
-    gchar *category_folder_path = g_strdup_printf("%s%s/%s", professor_base_dir, professor, global_categories[category_index]);
+/**
+ * @brief GFileMonitor handler: applies one filesystem event to the GUI.
+ *
+ * Only top-level *.pdf files are considered; sidecar caches, exiftool temp
+ * files and the old_files subfolder never match. Files written by our own
+ * save pipeline are filtered through monitor_self_paths.
+ */
+static void on_category_dir_changed(GFileMonitor *monitor, GFile *file, GFile *other_file,
+                                    GFileMonitorEvent event_type, gpointer user_data) {
+    (void)monitor;
+    gint category_index = GPOINTER_TO_INT(user_data);
 
-    g_print("Attempting to open category folder: %s\n", category_folder_path);
+    if (category_index < 0 || category_index >= global_num_categories) return;
 
-    if (!is_valid_path(category_folder_path)) {
-        g_warning("Invalid category folder path: %s", category_folder_path);
-        GtkWidget *dialog = gtk_message_dialog_new(NULL,
-                                                   GTK_DIALOG_MODAL,
-                                                   GTK_MESSAGE_ERROR,
-                                                   GTK_BUTTONS_OK,
-                                                   "Caminho inválido para a pasta da categoria: %s", category_folder_path);
-        gtk_dialog_run(GTK_DIALOG(dialog));
-        gtk_widget_destroy(dialog);
-        SAFE_FREE(category_folder_path);
-        SAFE_FREE(professor_base_dir);
+    gchar *path = g_file_get_path(file);
+    if (!path) return;
+
+    if (!filename_has_pdf_suffix(path)) {
+        SAFE_FREE(path);
         return;
     }
 
-
-    if (!g_file_test(category_folder_path, G_FILE_TEST_IS_DIR)) {
-        g_warning("Category folder does not exist: %s", category_folder_path);
-        GtkWidget *dialog = gtk_message_dialog_new(NULL,
-                                                   GTK_DIALOG_MODAL,
-                                                   GTK_MESSAGE_WARNING,
-                                                   GTK_BUTTONS_OK,
-                                                   "A pasta para a categoria '%s' do professor '%s' não existe.\n"
-                                                   "Por favor, use o botão 'Criar Pasta do Professor' para criá-la.",
-                                                   global_categories[category_index], professor);
-        gtk_dialog_run(GTK_DIALOG(dialog));
-        gtk_widget_destroy(dialog);
-        SAFE_FREE(category_folder_path);
-        SAFE_FREE(professor_base_dir);
+    if (monitor_self_paths && g_hash_table_contains(monitor_self_paths, path)) {
+        SAFE_FREE(path);
         return;
     }
 
-    GError *spawn_error = NULL;
-    gchar *command_line = g_strdup_printf("xdg-open \"%s\"", category_folder_path);
-
-    if (!g_spawn_command_line_async(command_line, &spawn_error)) {
-        GtkWidget *dialog = gtk_message_dialog_new(NULL,
-                                                   GTK_DIALOG_MODAL,
-                                                   GTK_MESSAGE_ERROR,
-                                                   GTK_BUTTONS_OK,
-                                                   "Falha ao abrir a pasta: %s", spawn_error ? spawn_error->message : "N/A");
-        gtk_dialog_run(GTK_DIALOG(dialog));
-        gtk_widget_destroy(dialog);
-        if (spawn_error) g_error_free(spawn_error);
-    } else {
-        g_print("Category folder opened successfully.\n");
+    switch (event_type) {
+        case G_FILE_MONITOR_EVENT_CHANGES_DONE_HINT:
+        case G_FILE_MONITOR_EVENT_MOVED_IN:
+            category_monitor_import_pdf(category_index, path);
+            break;
+        case G_FILE_MONITOR_EVENT_DELETED:
+        case G_FILE_MONITOR_EVENT_MOVED_OUT:
+            category_monitor_drop_pdf(category_index, path);
+            break;
+        case G_FILE_MONITOR_EVENT_RENAMED:
+            if (other_file) {
+                gchar *new_path = g_file_get_path(other_file);
+                category_monitor_drop_pdf(category_index, path);
+                if (new_path) {
+                    category_monitor_import_pdf(category_index, new_path);
+                    SAFE_FREE(new_path);
+                }
+            }
+            break;
+        default:
+            break;
     }
 
-    SAFE_FREE(command_line);
-    SAFE_FREE(category_folder_path);
-    SAFE_FREE(professor_base_dir);
+    SAFE_FREE(path);
 }
 
 /**
- * @brief Scans a folder for PDF files, creates PdfEntries, and adds to GUI.
+ * @brief Stops and releases all active category folder monitors.
  */
-void process_pdf_folder(const gchar *folder_path, gint category_index) {
-    DIR *d;
-    struct dirent *dir;
-    g_print("Starting PDF folder scan in: %s for category index %d\n", folder_path, category_index);
-
-    if (!is_valid_path(folder_path)) {
-        g_warning("Invalid folder path provided to process_pdf_folder: %s", folder_path);
-        return;
+void category_monitors_stop(void) {
+    if (category_monitors) {
+        for (gint i = 0; i < global_num_categories; i++) {
+            if (category_monitors[i]) {
+                g_file_monitor_cancel(category_monitors[i]);
+                g_object_unref(category_monitors[i]);
+            }
+        }
+        SAFE_FREE(category_monitors);
     }
+    if (monitor_self_paths) {
+        g_hash_table_destroy(monitor_self_paths);
+        monitor_self_paths = NULL;
+    }
+}
 
-    d = opendir(folder_path);
-    if (d) {
-        while ((dir = readdir(d)) != NULL) {
-            if (g_strcmp0(dir->d_name, ".") == 0 || g_strcmp0(dir->d_name, "..") == 0) {
-                continue;
-            }
+/**
+ * @brief Watches every category folder of @professor for external changes.
+ *
+ * Created/deleted/renamed PDFs are applied as incremental row insertions and
+ * removals, so picking up filesystem changes scales with the number of
+ * changed files; "Recarregar Professor" remains as a full-rescan fallback.
+ */
+void category_monitors_start(const gchar *professor) {
+    category_monitors_stop();
 
-            gchar *full_path = g_build_filename(folder_path, dir->d_name, NULL);
-            if (!is_valid_path(full_path)) {
-                g_warning("Skipping invalid file path: %s", full_path);
-                SAFE_FREE(full_path);
-                continue;
-            }
+    category_monitors = g_new0(GFileMonitor*, global_num_categories);
 
-            GFile *file = g_file_new_for_path(full_path);
-            GError *file_info_error = NULL;
-            GFileInfo *file_info = g_file_query_info(file, G_FILE_ATTRIBUTE_STANDARD_TYPE, G_FILE_QUERY_INFO_NONE, NULL, &file_info_error);
-
-            if (file_info && g_file_info_get_file_type(file_info) == G_FILE_TYPE_REGULAR) {
-                gchar *lower_case_filename = g_ascii_strdown(dir->d_name, -1);
-                if (g_str_has_suffix(lower_case_filename, ".pdf")) {
-                    g_print("  Found PDF: %s\n", full_path);
-
-                    PdfEntry *new_entry = create_pdf_entry();
-                    new_entry->file_path = g_strdup(full_path);
-
-                    GtkListBoxRow *row = create_pdf_entry_row(new_entry, category_index);
-                    gtk_file_chooser_set_filename(GTK_FILE_CHOOSER(new_entry->file_btn), full_path);
-
-                    add_pdf_entry_to_gui(category_index, new_entry, row);
-                    gtk_entry_set_text(GTK_ENTRY(new_entry->title_entry), "Carregando título...");
-                    gtk_entry_set_text(GTK_ENTRY(new_entry->year_entry), "Carregando ano...");
-                    gtk_entry_set_text(GTK_ENTRY(new_entry->category_entry), "Carregando categoria...");
-
-                    ExiftoolReadOperation *op = g_malloc0(sizeof(ExiftoolReadOperation));
-                    op->file_path = g_strdup(full_path);
-                    op->gui_row = row;
-                    op->category_index = category_index;
-                    op->is_new_file_selection = FALSE;
-
-                    gchar *quoted_full_path = g_shell_quote(op->file_path);
-                    gchar *command_line = g_strdup_printf("exiftool -j -Title -Year -Category %s", quoted_full_path);
-                    SAFE_FREE(quoted_full_path);
-
-                    gchar **argv = NULL;
-                    gint argc = 0;
-                    GError *spawn_error = NULL;
-                    gboolean success = g_shell_parse_argv(command_line, &argc, &argv, &spawn_error);
-                    if (!success) {
-                        g_warning("Failed to parse exiftool command line: %s (%s)", command_line, spawn_error ? spawn_error->message : "N/A");
-                        if (spawn_error) g_error_free(spawn_error);
-                        SAFE_FREE(command_line);
-                        SAFE_FREE(op->file_path);
-                        SAFE_FREE(op);
-                        SAFE_FREE(lower_case_filename);
-                        if (file_info) g_object_unref(file_info);
-                        if (file_info_error) g_error_free(file_info_error);
-                        if (file) g_object_unref(file);
-                        SAFE_FREE(full_path);
-                        continue;
-                    }
+    for (gint i = 0; i < global_num_categories; i++) {
+        gchar *folder_path = g_strdup_printf("./%s/%s", professor, global_categories[i]);
+        GFile *folder = g_file_new_for_path(folder_path);
+        GError *monitor_error = NULL;
+
+        category_monitors[i] = g_file_monitor_directory(folder, G_FILE_MONITOR_WATCH_MOVES,
+                                                        NULL, &monitor_error);
+        if (category_monitors[i]) {
+            g_signal_connect(category_monitors[i], "changed",
+                             G_CALLBACK(on_category_dir_changed), GINT_TO_POINTER(i));
+        } else {
+            g_warning("Could not watch category folder %s: %s",
+                      folder_path, monitor_error ? monitor_error->message : "N/A");
+            if (monitor_error) g_error_free(monitor_error);
+        }
 
-                    GPid pid;
-                    gint stdout_fd_local, stderr_fd_local;
-                    if (!g_spawn_async_with_pipes(NULL, argv, NULL, G_SPAWN_SEARCH_PATH | G_SPAWN_DO_NOT_REAP_CHILD,
-                                                  NULL, NULL, &pid, NULL, &stdout_fd_local, &stderr_fd_local, &spawn_error)) {
-                        g_warning("Failed to spawn exiftool process: %s", spawn_error ? spawn_error->message : "N/A");
-                        if (spawn_error) g_error_free(spawn_error);
-                        SAFE_FREE(op->file_path);
-                        SAFE_FREE(op);
-                        g_strfreev(argv);
-                        SAFE_FREE(command_line);
-                        SAFE_FREE(lower_case_filename);
-                        if (file_info) g_object_unref(file_info);
-                        if (file_info_error) g_error_free(file_info_error);
-                        if (file) g_object_unref(file);
-                        SAFE_FREE(full_path);
-                        continue;
-                    }
+        g_object_unref(folder);
+        SAFE_FREE(folder_path);
+    }
 
-                    op->stdout_fd = stdout_fd_local;
-                    op->stderr_fd = stderr_fd_local;
+    g_print("Category folder monitors active for professor '%s'.\n", professor);
+}
 
-                    g_strfreev(argv);
-                    SAFE_FREE(command_line);
+// =============================================================================
+// SESSION SNAPSHOT CACHE
+// =============================================================================
 
-                    g_child_watch_add(pid, exiftool_read_completed_callback, op);
-                }
-                SAFE_FREE(lower_case_filename);
-            }
-            if (file_info) g_object_unref(file_info);
-            if (file_info_error) g_error_free(file_info_error);
-            if (file) g_object_unref(file);
-            SAFE_FREE(full_path);
-        }
-        closedir(d);
-    } else {
-        g_warning("Could not open category directory: %s (%s). Skipping this category.", folder_path, g_strerror(errno));
+static GHashTable *professor_snapshots = NULL;   /* professor name -> ProfessorSnapshot* */
+static gchar *snapshot_active_professor = NULL;  /* whose entries the GUI currently shows */
+
+/**
+ * @brief Frees one SnapshotEntry (GDestroyNotify).
+ */
+static void snapshot_entry_free(gpointer data) {
+    SnapshotEntry *snap = (SnapshotEntry *)data;
+    if (snap) {
+        SAFE_FREE(snap->file_path);
+        SAFE_FREE(snap->title);
+        SAFE_FREE(snap->year);
+        SAFE_FREE(snap->category);
+        SAFE_FREE(snap->counter);
+        SAFE_FREE(snap->original_title);
+        SAFE_FREE(snap->original_year);
+        SAFE_FREE(snap->original_category);
+        SAFE_FREE(snap->original_filename_no_ext);
+        SAFE_FREE(snap);
     }
 }
 
 /**
- * @brief Saves a single PDF entry, copies file, and injects metadata.
+ * @brief Frees one ProfessorSnapshot (GDestroyNotify).
  */
-gboolean save_single_pdf_entry(PdfEntry *entry, const gchar *professor_name, gint category_index) {
-    const gchar *title_raw = gtk_entry_get_text(GTK_ENTRY(entry->title_entry));
-    const gchar *year = gtk_entry_get_text(GTK_ENTRY(entry->year_entry));
-    const gchar *manual_counter_str = gtk_entry_get_text(GTK_ENTRY(entry->counter_entry));
-    const gchar *current_category_text = gtk_entry_get_text(GTK_ENTRY(entry->category_entry));
+static void professor_snapshot_free(gpointer data) {
+    ProfessorSnapshot *snapshot = (ProfessorSnapshot *)data;
+    if (!snapshot) return;
 
-    if (!entry->file_path || g_strcmp0(entry->file_path, "") == 0 || !is_valid_path(entry->file_path)) {
-        g_warning("Skipping entry in category '%s': No valid file selected.", global_categories[category_index]);
-        return FALSE;
+    for (gint i = 0; i < snapshot->num_categories; i++) {
+        if (snapshot->entries[i]) {
+            g_ptr_array_free(snapshot->entries[i], TRUE);
+        }
     }
-    if (g_strcmp0(title_raw, "") == 0) {
-         g_warning("Skipping entry in category '%s' (file: %s): Title is empty.", global_categories[category_index], entry->file_path);
-         return FALSE;
+    SAFE_FREE(snapshot->entries);
+    SAFE_FREE(snapshot->dir_mtimes);
+    SAFE_FREE(snapshot->max_counters);
+    g_free(snapshot);
+}
+
+/**
+ * @brief Returns the mtime of one category folder, 0 if it does not exist.
+ */
+static gint64 snapshot_dir_mtime(const gchar *professor, gint category_index) {
+    gchar *dir_path = g_strdup_printf("./%s/%s", professor, global_categories[category_index]);
+    GStatBuf dir_stat;
+    gint64 mtime = 0;
+    if (g_stat(dir_path, &dir_stat) == 0) {
+        mtime = (gint64)dir_stat.st_mtime;
     }
-    if (g_strcmp0(year, "") == 0) {
-         g_warning("Skipping entry in category '%s' (file: %s): Year is empty.", global_categories[category_index], entry->file_path);
-         return FALSE;
+    SAFE_FREE(dir_path);
+    return mtime;
+}
+
+/**
+ * @brief Drops every cached snapshot (category config changed, shutdown).
+ */
+void professor_snapshots_clear(void) {
+    if (professor_snapshots) {
+        g_hash_table_destroy(professor_snapshots);
+        professor_snapshots = NULL;
     }
-    if (g_strcmp0(current_category_text, "") == 0) {
-         g_warning("Skipping entry in category '%s' (file: %s): Category is empty.", global_categories[category_index], entry->file_path);
-         return FALSE;
+    SAFE_FREE(snapshot_active_professor);
+}
+
+/**
+ * @brief Forgets the snapshot of one professor (explicit reload requested).
+ */
+void professor_snapshot_drop(const gchar *professor) {
+    if (professor_snapshots && professor) {
+        g_hash_table_remove(professor_snapshots, professor);
     }
+}
 
-    g_print("    Original File Selected: %s\n", entry->file_path);
-    g_print("    Entered Title: \"%s\", Entered Year: \"%s\", Entered Category: \"%s\", Manual Counter: \"%s\"\n",
-            title_raw, year, current_category_text, manual_counter_str);
+/**
+ * @brief Captures the current GUI state as a snapshot for @professor.
+ *
+ * Called when the user switches away. Skipped while metadata reads are
+ * still outstanding, so placeholders are never cached. Widget-free: only
+ * the accessor-visible entry data and per-category folder mtimes are kept.
+ */
+void professor_snapshot_store(const gchar *professor) {
+    if (!professor || !global_sections || global_num_categories <= 0) return;
 
-    gchar *sanitized_category_for_filename = sanitize_filename(current_category_text);
+    if (pdf_loads_outstanding > 0) {
+        g_print("Session snapshot for '%s' skipped: %d metadata read(s) still outstanding.\n",
+                professor, pdf_loads_outstanding);
+        return;
+    }
 
-    gchar *final_filename_no_ext = NULL;
-    gint current_counter = 0;
-    gboolean use_manual_counter_for_filename = FALSE;
+    ProfessorSnapshot *snapshot = g_new0(ProfessorSnapshot, 1);
+    snapshot->num_categories = global_num_categories;
+    snapshot->dir_mtimes = g_new0(gint64, global_num_categories);
+    snapshot->entries = g_new0(GPtrArray*, global_num_categories);
+    snapshot->max_counters = g_new0(gint, global_num_categories);
 
-    if (manual_counter_str && g_strcmp0(manual_counter_str, "") != 0) {
-        gint parsed_counter = atoi(manual_counter_str);
-        if (parsed_counter > 0) {
-            current_counter = parsed_counter;
-            use_manual_counter_for_filename = TRUE;
-            g_print("    Using manual counter: %02d\n", current_counter);
+    for (gint i = 0; i < global_num_categories; i++) {
+        snapshot->dir_mtimes[i] = snapshot_dir_mtime(professor, i);
+        snapshot->max_counters[i] = global_max_category_counters ? global_max_category_counters[i] : 0;
+        snapshot->entries[i] = g_ptr_array_new_with_free_func(snapshot_entry_free);
+
+        for (guint j = 0; j < global_sections[i].entries->len; j++) {
+            PdfEntry *entry = g_ptr_array_index(global_sections[i].entries, j);
+            SnapshotEntry *snap = g_new0(SnapshotEntry, 1);
+            snap->file_path = g_strdup(entry->file_path);
+            snap->file_size = entry->file_size;
+            snap->page_count = entry->page_count;
+            snap->title = g_strdup(pdf_entry_get_title(entry));
+            snap->year = g_strdup(pdf_entry_get_year(entry));
+            snap->category = g_strdup(pdf_entry_get_category(entry));
+            snap->counter = g_strdup(pdf_entry_get_counter(entry));
+            snap->original_title = g_strdup(entry->original_title);
+            snap->original_year = g_strdup(entry->original_year);
+            snap->original_category = g_strdup(entry->original_category);
+            snap->original_filename_no_ext = g_strdup(entry->original_filename_no_ext);
+            snap->has_original_counter = entry->has_original_counter;
+            snap->original_detected_counter = entry->original_detected_counter;
+            snap->current_counter_value = entry->current_counter_value;
+            g_ptr_array_add(snapshot->entries[i], snap);
         }
     }
 
-    if (use_manual_counter_for_filename) {
-        final_filename_no_ext = g_strdup_printf("%02d_%s_%s", current_counter, sanitized_category_for_filename, year);
-    } else {
-        if (entry->has_original_counter && entry->original_detected_counter > 0) {
-            current_counter = entry->original_detected_counter;
-            g_print("    Using detected original counter: %02d\n", current_counter);
-        } else {
-            global_max_category_counters[category_index]++;
-            current_counter = global_max_category_counters[category_index];
-            g_print("    Assigning new counter: %02d\n", current_counter);
-        }
-        final_filename_no_ext = g_strdup_printf("%02d_%s_%s", current_counter, sanitized_category_for_filename, year);
+    if (!professor_snapshots) {
+        professor_snapshots = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, professor_snapshot_free);
     }
+    g_hash_table_replace(professor_snapshots, g_strdup(professor), snapshot);
+    g_print("Session snapshot stored for '%s'.\n", professor);
+}
 
-    gchar *professor_base_dir = g_strdup("./");
-    gchar *dest_category_dir = g_strdup_printf("%s%s/%s", professor_base_dir, professor_name, global_categories[category_index]);
-    g_print("    Attempting to ensure category directory exists: %s\n", dest_category_dir);
+/**
+ * @brief Rebuilds the GUI for @professor from its snapshot, if still valid.
+ *
+ * Validity means the category layout is unchanged and every category
+ * folder's mtime matches the capture. Replaying costs zero exiftool work
+ * and one stat per category; stale snapshots are dropped and FALSE is
+ * returned so the caller runs the normal folder scan.
+ */
+gboolean professor_snapshot_restore(const gchar *professor) {
+    if (!professor_snapshots || !professor) return FALSE;
 
-    if (!is_valid_path(dest_category_dir)) {
-        g_warning("Invalid destination category directory path: %s", dest_category_dir);
-        SAFE_FREE(sanitized_category_for_filename);
-        SAFE_FREE(final_filename_no_ext);
-        SAFE_FREE(dest_category_dir);
-        SAFE_FREE(professor_base_dir);
+    ProfessorSnapshot *snapshot = g_hash_table_lookup(professor_snapshots, professor);
+    if (!snapshot) return FALSE;
+
+    if (snapshot->num_categories != global_num_categories) {
+        g_hash_table_remove(professor_snapshots, professor);
         return FALSE;
     }
 
-    if (!g_mkdir_with_parents(dest_category_dir, 0755)) {
-        if (errno != EEXIST) {
-            g_warning("Failed to create category directory: %s (%s)", dest_category_dir, g_strerror(errno));
-            SAFE_FREE(sanitized_category_for_filename);
-            SAFE_FREE(final_filename_no_ext);
-            SAFE_FREE(dest_category_dir);
-            SAFE_FREE(professor_base_dir);
+    for (gint i = 0; i < global_num_categories; i++) {
+        if (snapshot_dir_mtime(professor, i) != snapshot->dir_mtimes[i]) {
+            g_print("Session snapshot for '%s' stale (category '%s' changed on disk); rescanning.\n",
+                    professor, global_categories[i]);
+            g_hash_table_remove(professor_snapshots, professor);
             return FALSE;
         }
     }
-    g_print("    Category directory exists (or was created): %s\n", dest_category_dir);
 
-    gchar *dest_file_name = g_strdup_printf("%s.pdf", final_filename_no_ext);
-    gchar *dest_file_path = g_strdup_printf("%s/%s", dest_category_dir, dest_file_name);
-    g_print("    Destination file path: %s\n", dest_file_path);
+    for (gint i = 0; i < global_num_categories; i++) {
+        global_max_category_counters[i] = snapshot->max_counters[i];
+
+        for (guint j = 0; j < snapshot->entries[i]->len; j++) {
+            SnapshotEntry *snap = g_ptr_array_index(snapshot->entries[i], j);
+
+            PdfEntry *entry = create_pdf_entry();
+            entry->file_path = session_strdup(snap->file_path);
+            entry->file_size = snap->file_size;
+            entry->page_count = snap->page_count;
+            pdf_entry_set_title(entry, snap->title ? snap->title : "");
+            pdf_entry_set_year(entry, snap->year ? snap->year : "");
+            pdf_entry_set_category(entry, snap->category ? snap->category : "");
+            pdf_entry_set_counter(entry, snap->counter ? snap->counter : "");
+            entry->original_title = session_strdup(snap->original_title);
+            entry->original_year = session_intern(snap->original_year);
+            entry->original_category = session_intern(snap->original_category);
+            entry->original_filename_no_ext = session_strdup(snap->original_filename_no_ext);
+            entry->has_original_counter = snap->has_original_counter;
+            entry->original_detected_counter = snap->original_detected_counter;
+            entry->current_counter_value = snap->current_counter_value;
+
+            add_pdf_entry_to_gui(i, entry, NULL);
+        }
 
-    if (!is_valid_path(dest_file_path)) {
-        g_warning("Invalid destination file path: %s", dest_file_path);
-        SAFE_FREE(sanitized_category_for_filename);
-        SAFE_FREE(final_filename_no_ext);
-        SAFE_FREE(dest_file_name);
-        SAFE_FREE(dest_file_path);
-        SAFE_FREE(dest_category_dir);
-        SAFE_FREE(professor_base_dir);
+        category_section_materialize_rows(i, PDF_ROWS_MATERIALIZE_CHUNK);
+    }
+
+    g_print("Session snapshot replayed for '%s' (no exiftool work needed).\n", professor);
+    return TRUE;
+}
+
+/**
+ * @brief Loads categories from 'config/categories.txt'.
+ */
+/**
+ * @brief Parses a category file into a NULL-terminated array without
+ * touching the globals, so callers can diff before committing.
+ */
+static gchar** read_category_lines(const gchar *filepath, gint *count) {
+    *count = 0;
+
+    // One read, one split: no per-line getline allocations.
+    gchar *contents = NULL;
+    GError *error = NULL;
+    if (!g_file_get_contents(filepath, &contents, NULL, &error)) {
+        g_warning("Could not open categories file '%s': %s", filepath,
+                  error ? error->message : "unknown");
+        if (error) g_error_free(error);
+        return NULL;
+    }
+
+    gchar **lines = g_strsplit(contents, "\n", -1);
+    SAFE_FREE(contents);
+
+    gint n = 0;
+    for (gint i = 0; lines[i] != NULL; i++) {
+        g_strchomp(lines[i]);
+        if (*lines[i] != '\0') n++;
+    }
+    if (n == 0) {
+        g_warning("No categories found in '%s'. Please add categories, one per line.", filepath);
+        g_strfreev(lines);
+        return NULL;
+    }
+
+    gchar **categories = g_new0(gchar*, n + 1);
+    gint out = 0;
+    for (gint i = 0; lines[i] != NULL; i++) {
+        if (*lines[i] != '\0') {
+            categories[out++] = g_strdup(lines[i]);
+        }
+    }
+    categories[out] = NULL;
+    g_strfreev(lines);
+
+    *count = n;
+    return categories;
+}
+
+gboolean load_categories_from_file(const gchar *filepath) {
+    gint count = 0;
+    gchar **categories = read_category_lines(filepath, &count);
+    if (!categories) {
         return FALSE;
     }
 
-    GFile *source_file = g_file_new_for_path(entry->file_path);
-    GFile *destination_file = g_file_new_for_path(dest_file_path);
+    if (global_categories) {
+        for (gint i = 0; i < global_num_categories; i++) {
+            SAFE_FREE(global_categories[i]);
+        }
+        SAFE_FREE(global_categories);
+    }
+    global_categories = categories;
+    global_num_categories = count;
 
-    GError *copy_error = NULL;
-    if (!g_file_copy(source_file, destination_file, G_FILE_COPY_OVERWRITE, NULL, NULL, NULL, &copy_error)) {
-        g_warning("Failed to copy file from %s to %s: %s", entry->file_path, dest_file_path, copy_error ? copy_error->message : "N/A");
-        if (copy_error) g_error_free(copy_error);
-        if (source_file) g_object_unref(source_file);
-        if (destination_file) g_object_unref(destination_file);
-        SAFE_FREE(sanitized_category_for_filename);
-        SAFE_FREE(final_filename_no_ext);
-        SAFE_FREE(dest_file_name);
-        SAFE_FREE(dest_file_path);
-        SAFE_FREE(dest_category_dir);
-        SAFE_FREE(professor_base_dir);
+    g_print("Loaded %d categories from '%s'.\n", global_num_categories, filepath);
+    return TRUE;
+}
+
+/**
+ * @brief Loads professor names from 'config/professores.txt'.
+ */
+gboolean load_professors_from_file(const gchar *filepath) {
+    gtk_combo_box_text_remove_all(GTK_COMBO_BOX_TEXT(professor_combo));
+
+    gchar *contents = NULL;
+    if (g_file_get_contents(filepath, &contents, NULL, NULL)) {
+        gchar **lines = g_strsplit(contents, "\n", -1);
+        SAFE_FREE(contents);
+        for (gint i = 0; lines[i] != NULL; i++) {
+            g_strchomp(lines[i]);
+            if (*lines[i] != '\0') {
+                gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(professor_combo), lines[i]);
+            }
+        }
+        g_strfreev(lines);
+        return TRUE;
+    } else {
+        g_warning("Could not open 'config/professores.txt'. Please ensure the file exists.");
+        gtk_combo_box_text_append_text(GTK_COMBO_BOX_TEXT(professor_combo), "Nenhum Professor Disponível");
         return FALSE;
     }
-    g_print("    File successfully copied to: %s\n", dest_file_path);
+}
+
+/**
+ * @brief Saves professor list from config dialog and creates directories.
+ */
+void save_professors_list(GtkWidget *button, gpointer user_data) {
+    (void)button;
+    (void)user_data;
+
+    GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(professors_text_view));
+    GtkTextIter start, end;
+    gtk_text_buffer_get_start_iter(buffer, &start);
+    gtk_text_buffer_get_end_iter(buffer, &end);
+    gchar *content = gtk_text_buffer_get_text(buffer, &start, &end, FALSE);
+
+    GError *error = NULL;
+    if (g_file_set_contents("config/professores.txt", content, -1, &error)) {
+        g_print("Professors list saved. Now creating directories...\n");
+        gchar *professor_base_dir = g_strdup("./");
+
+        gchar **professors_array = g_strsplit(content, "\n", 0);
+        for (gint p_idx = 0; professors_array[p_idx] != NULL; p_idx++) {
+            gchar *professor_name = g_strstrip(professors_array[p_idx]);
+            if (g_strcmp0(professor_name, "") == 0) continue;
+
+            g_print("  Processing professor: %s\n", professor_name);
+
+            gchar *professor_folder_path = g_strdup_printf("%s%s", professor_base_dir, professor_name);
+            if (!g_mkdir_with_parents(professor_folder_path, 0755)) {
+                if (errno != EEXIST) {
+                    g_warning("    Failed to create professor directory '%s': %s", professor_folder_path, g_strerror(errno));
+                } else {
+                    g_print("    Professor directory already exists: %s\n", professor_folder_path);
+                }
+            } else {
+                g_print("    Professor directory created: %s\n", professor_folder_path);
+            }
+
+            for (gint c_idx = 0; c_idx < global_num_categories; c_idx++) {
+                if (c_idx < 0 || c_idx >= global_num_categories || !global_categories[c_idx]) {
+                    g_warning("Invalid category index or NULL category name during directory creation for professor '%s'. Skipping.", professor_name);
+                    continue;
+                }
+                gchar *category_folder_path = g_strdup_printf("%s/%s", professor_folder_path, global_categories[c_idx]);
+                if (!g_mkdir_with_parents(category_folder_path, 0755)) {
+                    if (errno != EEXIST) {
+                        g_warning("      Failed to create category directory '%s' for '%s': %s",
+                                  global_categories[c_idx], professor_name, g_strerror(errno));
+                    } else {
+                        g_print("      Category directory already exists: %s\n", category_folder_path);
+                    }
+                } else {
+                    g_print("      Category directory created: %s\n", category_folder_path);
+                }
+                SAFE_FREE(category_folder_path);
+            }
+            SAFE_FREE(professor_folder_path);
+        }
+        g_strfreev(professors_array);
+        SAFE_FREE(professor_base_dir);
+
+        GtkWidget *dialog = gtk_message_dialog_new(NULL, GTK_DIALOG_MODAL, GTK_MESSAGE_INFO, GTK_BUTTONS_OK, "Lista de professores salva com sucesso!");
+        gtk_dialog_run(GTK_DIALOG(dialog));
+        gtk_widget_destroy(dialog);
+        refresh_professor_combo();
+    } else {
+        GtkWidget *dialog = gtk_message_dialog_new(NULL, GTK_DIALOG_MODAL, GTK_MESSAGE_ERROR, GTK_BUTTONS_OK, "Erro ao salvar lista de professores: %s", error ? error->message : "N/A");
+        gtk_dialog_run(GTK_DIALOG(dialog));
+        gtk_widget_destroy(dialog);
+        if (error) g_error_free(error);
+    }
+    SAFE_FREE(content);
+}
+
+/**
+ * @brief Saves category list from config dialog.
+ */
+void save_categories_list(GtkWidget *button, gpointer user_data) {
+    (void)button;
+    (void)user_data;
+
+    GtkTextBuffer *buffer = gtk_text_view_get_buffer(GTK_TEXT_VIEW(categories_text_view));
+    GtkTextIter start, end;
+    gtk_text_buffer_get_start_iter(buffer, &start);
+    gtk_text_buffer_get_end_iter(buffer, &end);
+    gchar *content = gtk_text_buffer_get_text(buffer, &start, &end, FALSE);
+
+    GError *error = NULL;
+    if (g_file_set_contents("config/categories.txt", content, -1, &error)) {
+        GtkWidget *dialog = gtk_message_dialog_new(NULL, GTK_DIALOG_MODAL, GTK_MESSAGE_INFO, GTK_BUTTONS_OK, "Lista de categorias salva com sucesso!");
+        gtk_dialog_run(GTK_DIALOG(dialog));
+        gtk_widget_destroy(dialog);
+        refresh_category_gui();
+    } else {
+        GtkWidget *dialog = gtk_message_dialog_new(NULL, GTK_DIALOG_MODAL, GTK_MESSAGE_ERROR, GTK_BUTTONS_OK, "Erro ao salvar lista de categorias: %s", error ? error->message : "N/A");
+        gtk_dialog_run(GTK_DIALOG(dialog));
+        gtk_widget_destroy(dialog);
+        if (error) g_error_free(error);
+    }
+    SAFE_FREE(content);
+}
+
+// =============================================================================
+// GUI MANAGEMENT FUNCTIONS
+// =============================================================================
+
+/**
+ * @brief Cleans up all existing category GUI elements.
+ */
+void cleanup_category_gui() {
+    pdf_load_generation++;
+    pdf_loads_outstanding = 0;
+    pdf_loads_total = 0;
+    category_monitors_stop();
+    // Snapshots describe the old category layout; none survive a rebuild.
+    professor_snapshots_clear();
+
+    if (global_sections) {
+        for (gint i = 0; i < global_num_categories; i++) {
+            // Entries without a row have no widget to free them via
+            // GDestroyNotify; release them here.
+            if (global_sections[i].entries) {
+                for (guint j = 0; j < global_sections[i].entries->len; j++) {
+                    PdfEntry *entry = g_ptr_array_index(global_sections[i].entries, j);
+                    if (entry && !entry->row) {
+                        pdf_entry_destroy_notify(entry);
+                    }
+                }
+            }
+            if (global_sections[i].frame) {
+                gtk_widget_destroy(global_sections[i].frame);
+            }
+            if (global_sections[i].entries) {
+                g_ptr_array_free(global_sections[i].entries, TRUE);
+                global_sections[i].entries = NULL;
+            }
+            if (global_sections[i].unmaterialized) {
+                g_ptr_array_free(global_sections[i].unmaterialized, TRUE);
+                global_sections[i].unmaterialized = NULL;
+            }
+        }
+        SAFE_FREE(global_sections);
+    }
+
+    session_arena_reset();
+
+    if (category_content_vbox) {
+        GList *children = gtk_container_get_children(GTK_CONTAINER(category_content_vbox));
+        for (GList *l = children; l != NULL; l = g_list_next(l)) {
+            gtk_widget_destroy(GTK_WIDGET(l->data));
+        }
+        g_list_free(children);
+    }
+
+    if (category_nav_list_box) {
+        GList *children = gtk_container_get_children(GTK_CONTAINER(category_nav_list_box));
+        for (GList *l = children; l != NULL; l = l->next) {
+            gtk_widget_destroy(GTK_WIDGET(l->data));
+        }
+        g_list_free(children);
+    }
+}
+
+/**
+ * @brief Points a section's index-carrying widgets at a (possibly new)
+ * category index. Handlers read "category-index" at click time, so a
+ * differential reload only has to update this object data.
+ */
+static void category_section_set_index(CategorySection *section, gint index) {
+    g_object_set_data(G_OBJECT(section->add_btn), "category-index", GINT_TO_POINTER(index));
+    g_object_set_data(G_OBJECT(section->open_folder_btn), "category-index", GINT_TO_POINTER(index));
+    g_object_set_data(G_OBJECT(section->vadjustment), "category-index", GINT_TO_POINTER(index));
+}
+
+/**
+ * @brief Builds one category section's widgets and packs its frame at the
+ * end of the content vbox.
+ */
+static void category_section_build(CategorySection *section, gint index) {
+    section->frame = gtk_frame_new(global_categories[index]);
+    section->entries = g_ptr_array_new();
+    section->unmaterialized = g_ptr_array_new();
+    GtkWidget *box = gtk_box_new(GTK_ORIENTATION_VERTICAL, 5);
+
+    section->list = gtk_list_box_new();
+    gtk_list_box_set_selection_mode(GTK_LIST_BOX(section->list), GTK_SELECTION_NONE);
+    gtk_widget_set_hexpand(GTK_WIDGET(section->list), TRUE);
+    gtk_widget_set_halign(GTK_WIDGET(section->list), GTK_ALIGN_FILL);
+
+    GtkWidget *buttons_hbox = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 5);
+    gtk_widget_set_halign(buttons_hbox, GTK_ALIGN_END);
+
+    section->add_btn = gtk_button_new_with_label("Adicionar PDF");
+    g_signal_connect(section->add_btn, "clicked", G_CALLBACK(add_pdf_entry), NULL);
+    gtk_box_pack_end(GTK_BOX(buttons_hbox), section->add_btn, FALSE, FALSE, 0);
+
+    section->open_folder_btn = gtk_button_new_with_label("Abrir Pasta");
+    g_signal_connect(section->open_folder_btn, "clicked", G_CALLBACK(on_open_category_folder), NULL);
+    gtk_box_pack_end(GTK_BOX(buttons_hbox), section->open_folder_btn, FALSE, FALSE, 0);
+
+    GtkWidget *list_scrolled_window = gtk_scrolled_window_new(NULL, NULL);
+    gtk_scrolled_window_set_policy(GTK_SCROLLED_WINDOW(list_scrolled_window),
+                                   GTK_POLICY_AUTOMATIC, GTK_POLICY_AUTOMATIC);
+    gtk_widget_set_hexpand(list_scrolled_window, TRUE);
+    gtk_widget_set_halign(list_scrolled_window, GTK_ALIGN_FILL);
+    gtk_widget_set_size_request(list_scrolled_window, -1, 300);
+    gtk_container_add(GTK_CONTAINER(list_scrolled_window), section->list);
+
+    section->vadjustment = gtk_scrolled_window_get_vadjustment(GTK_SCROLLED_WINDOW(list_scrolled_window));
+    g_signal_connect(section->vadjustment, "value-changed",
+                     G_CALLBACK(on_section_scroll_changed), NULL);
+
+    category_section_set_index(section, index);
+
+    gtk_box_pack_start(GTK_BOX(box), list_scrolled_window, TRUE, TRUE, 0);
+    gtk_box_pack_start(GTK_BOX(box), buttons_hbox, FALSE, FALSE, 0);
+    gtk_container_add(GTK_CONTAINER(section->frame), box);
+
+    gtk_box_pack_start(GTK_BOX(category_content_vbox), section->frame, TRUE, TRUE, 30);
+    gtk_widget_set_hexpand(GTK_WIDGET(section->frame), TRUE);
+    gtk_widget_set_halign(GTK_WIDGET(section->frame), GTK_ALIGN_FILL);
+    gtk_widget_set_vexpand(GTK_WIDGET(section->frame), TRUE);
+}
+
+/**
+ * @brief Rebuilds the navigation shortcut list to match global_categories.
+ * Cheap (one button per category), so the reload never diffs it.
+ */
+static void category_nav_rebuild(void) {
+    GList *children = gtk_container_get_children(GTK_CONTAINER(category_nav_list_box));
+    for (GList *l = children; l != NULL; l = g_list_next(l)) {
+        gtk_widget_destroy(GTK_WIDGET(l->data));
+    }
+    g_list_free(children);
+
+    for (gint i = 0; i < global_num_categories; i++) {
+        GtkWidget *shortcut_btn = gtk_button_new_with_label(global_categories[i]);
+        g_object_set_data(G_OBJECT(shortcut_btn), "category-frame", global_sections[i].frame);
+        g_signal_connect(shortcut_btn, "clicked", G_CALLBACK(on_category_shortcut_clicked), NULL);
+
+        GtkWidget *row = gtk_list_box_row_new();
+        gtk_container_add(GTK_CONTAINER(row), shortcut_btn);
+        gtk_list_box_insert(GTK_LIST_BOX(category_nav_list_box), GTK_WIDGET(row), -1);
+    }
+    gtk_widget_show_all(category_nav_list_box);
+}
+
+/**
+ * @brief Creates and populates category GUI elements.
+ */
+void create_category_gui(GtkWidget *nav_list_box, GtkWidget *content_vbox) {
+    (void)nav_list_box;
+    (void)content_vbox;
+
+    global_sections = g_new0(CategorySection, global_num_categories);
+
+    for(gint i = 0; i < global_num_categories; i++) {
+        category_section_build(&global_sections[i], i);
+    }
+    category_nav_rebuild();
+    gtk_widget_show_all(category_content_vbox);
+    category_gui_built = TRUE;
+}
+
+/**
+ * @brief Builds the category sections if the deferred startup idle has
+ * not run yet (first selection can beat it).
+ */
+void ensure_category_gui(void) {
+    if (category_gui_built) return;
+    create_category_gui(category_nav_list_box, category_content_vbox);
+}
+
+/**
+ * @brief Startup idle: builds the category frames after the window has
+ * already mapped, so launch feels instant.
+ */
+static gboolean create_category_gui_idle(gpointer user_data) {
+    (void)user_data;
+    ensure_category_gui();
+    return G_SOURCE_REMOVE;
+}
+
+/**
+ * @brief Refreshes the category GUI after config changes.
+ *
+ * Differential: the freshly parsed list is diffed against
+ * global_categories and only the delta is applied. Sections whose
+ * category survived keep their frame, list box and loaded entries (only
+ * their index data is retargeted); inserted categories get fresh sections
+ * and, with a professor active, a folder scan; removed ones are torn
+ * down. Editing one category no longer throws away every populated row.
+ */
+void refresh_category_gui() {
+    g_print("Refreshing category GUI...\n");
+
+    ensure_category_gui();
+
+    gint new_count = 0;
+    gchar **new_categories = read_category_lines("config/categories.txt", &new_count);
+    if (!new_categories) {
+        g_warning("Failed to refresh categories after loading from file.");
+        return;
+    }
+
+    if (new_count == global_num_categories) {
+        gboolean unchanged = TRUE;
+        for (gint i = 0; i < new_count; i++) {
+            if (g_strcmp0(new_categories[i], global_categories[i]) != 0) {
+                unchanged = FALSE;
+                break;
+            }
+        }
+        if (unchanged) {
+            g_print("Category list unchanged; keeping current GUI.\n");
+            g_strfreev(new_categories);
+            return;
+        }
+    }
+
+    // In-flight exiftool reads hold entry pointers and old-space category
+    // indices; the differential path below frees the former and
+    // reallocates the tables the latter index into. Mid-scan, fall back
+    // to a full rebuild instead: cleanup_category_gui bumps
+    // pdf_load_generation and zeroes the load counters (same as a
+    // professor switch), and the fresh scan re-queues whatever the
+    // abandoned reads still owed.
+    if (pdf_loads_outstanding > 0) {
+        g_print("Category refresh with %d metadata read(s) outstanding; rebuilding from scratch.\n",
+                pdf_loads_outstanding);
+        cleanup_category_gui();
+        if (global_categories) {
+            for (gint j = 0; j < global_num_categories; j++) {
+                SAFE_FREE(global_categories[j]);
+            }
+            SAFE_FREE(global_categories);
+        }
+        global_categories = new_categories;
+        global_num_categories = new_count;
+        create_category_gui(category_nav_list_box, category_content_vbox);
+        on_professor_selected(GTK_COMBO_BOX(professor_combo), NULL);
+        return;
+    }
+
+    const gchar *professor = gtk_combo_box_text_get_active_text(GTK_COMBO_BOX_TEXT(professor_combo));
+
+    // Snapshots and folder monitors are keyed by the old index space.
+    professor_snapshots_clear();
+    category_monitors_stop();
+
+    CategorySection *new_sections = g_new0(CategorySection, new_count);
+    gint *new_counters = g_new0(gint, new_count);
+    gint64 *new_bytes = g_new0(gint64, new_count);
+    gboolean *old_kept = g_new0(gboolean, global_num_categories);
+    gboolean *is_inserted = g_new0(gboolean, new_count);
+
+    for (gint i = 0; i < new_count; i++) {
+        gint match = -1;
+        for (gint j = 0; j < global_num_categories; j++) {
+            if (!old_kept[j] && g_strcmp0(new_categories[i], global_categories[j]) == 0) {
+                match = j;
+                break;
+            }
+        }
+        if (match >= 0) {
+            old_kept[match] = TRUE;
+            new_sections[i] = global_sections[match];
+            if (global_max_category_counters) new_counters[i] = global_max_category_counters[match];
+            if (global_category_total_bytes) new_bytes[i] = global_category_total_bytes[match];
+            category_section_set_index(&new_sections[i], i);
+            if (new_sections[i].entries) {
+                for (guint k = 0; k < new_sections[i].entries->len; k++) {
+                    PdfEntry *entry = g_ptr_array_index(new_sections[i].entries, k);
+                    if (entry) entry->category_index = i;
+                }
+            }
+        } else {
+            is_inserted[i] = TRUE;
+        }
+    }
+
+    // Tear down sections whose category was removed from the file.
+    for (gint j = 0; j < global_num_categories; j++) {
+        if (old_kept[j]) continue;
+        g_print("Categoria removida do config: %s\n", global_categories[j]);
+        CategorySection *old_section = &global_sections[j];
+        if (old_section->entries) {
+            for (guint k = 0; k < old_section->entries->len; k++) {
+                PdfEntry *entry = g_ptr_array_index(old_section->entries, k);
+                if (entry && !entry->row) {
+                    pdf_entry_destroy_notify(entry);
+                }
+            }
+            g_ptr_array_free(old_section->entries, TRUE);
+        }
+        if (old_section->unmaterialized) {
+            g_ptr_array_free(old_section->unmaterialized, TRUE);
+        }
+        if (old_section->frame) {
+            gtk_widget_destroy(old_section->frame);
+        }
+    }
+    SAFE_FREE(old_kept);
+
+    // Commit the new tables.
+    if (global_categories) {
+        for (gint j = 0; j < global_num_categories; j++) {
+            SAFE_FREE(global_categories[j]);
+        }
+        SAFE_FREE(global_categories);
+    }
+    SAFE_FREE(global_sections);
+    global_categories = new_categories;
+    global_num_categories = new_count;
+    global_sections = new_sections;
+    SAFE_FREE(global_max_category_counters);
+    global_max_category_counters = new_counters;
+    SAFE_FREE(global_category_total_bytes);
+    global_category_total_bytes = new_bytes;
+
+    // Build widgets for inserted categories, then settle every frame at
+    // its new position and refresh the labels.
+    for (gint i = 0; i < global_num_categories; i++) {
+        if (is_inserted[i]) {
+            category_section_build(&global_sections[i], i);
+        }
+    }
+    for (gint i = 0; i < global_num_categories; i++) {
+        gtk_box_reorder_child(GTK_BOX(category_content_vbox), global_sections[i].frame, i);
+        category_stats_update_label(i);
+    }
+    category_nav_rebuild();
+    gtk_widget_show_all(category_content_vbox);
+
+    // With a professor selected, scan only the inserted categories and
+    // re-arm the monitors for the new layout. Preserved sections keep
+    // their entries untouched.
+    if (professor && g_strcmp0(professor, "") != 0) {
+        for (gint i = 0; i < global_num_categories; i++) {
+            if (!is_inserted[i]) continue;
+            gchar *category_folder_path = g_strdup_printf("./%s/%s", professor, global_categories[i]);
+            if (g_file_test(category_folder_path, G_FILE_TEST_IS_DIR)) {
+                process_pdf_folder(category_folder_path, i);
+            }
+            gtk_list_box_set_sort_func(GTK_LIST_BOX(global_sections[i].list), (GtkListBoxSortFunc)compare_pdf_entries_by_counter, NULL, NULL);
+            gtk_list_box_invalidate_sort(GTK_LIST_BOX(global_sections[i].list));
+            SAFE_FREE(category_folder_path);
+        }
+        category_monitors_start(professor);
+    }
+    SAFE_FREE(is_inserted);
+
+    g_print("Category GUI refreshed: %d categoria(s).\n", global_num_categories);
+}
+
+/**
+ * @brief Refreshes the professor combo box after config changes,
+ * preserving the current selection when it survives the edit (restored
+ * with the changed handler blocked, so the loaded entries stay put).
+ */
+void refresh_professor_combo() {
+    g_print("Refreshing professor combo...\n");
+
+    gchar *previous = gtk_combo_box_text_get_active_text(GTK_COMBO_BOX_TEXT(professor_combo));
+
+    if (!load_professors_from_file("config/professores.txt")) {
+        g_warning("Failed to refresh professors after loading from file.");
+    }
+
+    gint restored = -1;
+    if (previous) {
+        GtkTreeModel *model = gtk_combo_box_get_model(GTK_COMBO_BOX(professor_combo));
+        GtkTreeIter iter;
+        gint idx = 0;
+        gboolean valid = gtk_tree_model_get_iter_first(model, &iter);
+        while (valid) {
+            gchar *text = NULL;
+            gtk_tree_model_get(model, &iter, 0, &text, -1);
+            gboolean found = (g_strcmp0(text, previous) == 0);
+            SAFE_FREE(text);
+            if (found) {
+                restored = idx;
+                break;
+            }
+            idx++;
+            valid = gtk_tree_model_iter_next(model, &iter);
+        }
+    }
+
+    if (restored >= 0) {
+        g_signal_handlers_block_by_func(professor_combo, G_CALLBACK(on_professor_selected), NULL);
+        gtk_combo_box_set_active(GTK_COMBO_BOX(professor_combo), restored);
+        g_signal_handlers_unblock_by_func(professor_combo, G_CALLBACK(on_professor_selected), NULL);
+        g_print("Professor selection preserved: %s\n", previous);
+    } else {
+        gtk_combo_box_set_active_id(GTK_COMBO_BOX(professor_combo), NULL);
+    }
+    SAFE_FREE(previous);
+}
+
+/**
+ * @brief Adds a new, blank PdfEntry to the GUI.
+ */
+void add_pdf_entry(GtkWidget *widget, gpointer user_data) {
+    (void)user_data;
+
+    gint category_index = GPOINTER_TO_INT(g_object_get_data(G_OBJECT(widget), "category-index"));
+    if (category_index < 0 || category_index >= global_num_categories) {
+        g_warning("Invalid category index %d in add_pdf_entry.", category_index);
+        return;
+    }
+
+    const gchar *professor = gtk_combo_box_text_get_active_text(GTK_COMBO_BOX_TEXT(professor_combo));
+
+    if (!professor || g_strcmp0(professor, "") == 0) {
+        GtkWidget *dialog = gtk_message_dialog_new(NULL,
+                                                   GTK_DIALOG_MODAL,
+                                                   GTK_MESSAGE_ERROR,
+                                                   GTK_BUTTONS_OK,
+                                                   "Por favor, selecione um professor antes de adicionar um PDF.");
+        gtk_dialog_run(GTK_DIALOG(dialog));
+        gtk_widget_destroy(dialog);
+        return;
+    }
+
+    PdfEntry *entry = create_pdf_entry();
+    entry->has_original_counter = FALSE;
+    entry->original_detected_counter = 0;
+    entry->current_counter_value = 0;
+    entry->original_filename_no_ext = session_strdup("");
+    entry->original_category = session_intern(global_categories[category_index]);
+
+    GtkListBoxRow *row = create_pdf_entry_row(entry, category_index);
+
+    add_pdf_entry_to_gui(category_index, entry, row);
+}
+
+/**
+ * @brief Removes a PdfEntry from GUI and moves its file to 'old_files'.
+ */
+// =============================================================================
+// ASYNC FILE MOVE QUEUE
+// =============================================================================
+
+/**
+ * @brief One queued move: src -> dest, with a short label for notifications.
+ */
+typedef struct {
+    gchar *src_path;
+    gchar *dest_path;
+    gchar *description;
+} FileMoveRequest;
+
+static GThreadPool *move_pool = NULL;
+
+static void file_move_request_free(FileMoveRequest *request) {
+    SAFE_FREE(request->src_path);
+    SAFE_FREE(request->dest_path);
+    SAFE_FREE(request->description);
+    SAFE_FREE(request);
+}
+
+/**
+ * @brief Main-thread notification for a failed queued move (non-modal).
+ */
+static gboolean file_move_failed_idle(gpointer data) {
+    FileMoveRequest *request = (FileMoveRequest *)data;
+
+    if (status_label) {
+        gchar *message = g_strdup_printf("Falha ao mover arquivo (%s): %s",
+                                         request->description, request->src_path);
+        gtk_label_set_text(GTK_LABEL(status_label), message);
+        SAFE_FREE(message);
+    }
+
+    file_move_request_free(request);
+    return G_SOURCE_REMOVE;
+}
+
+/**
+ * @brief Worker-side body of a queued move. Never touches GTK.
+ */
+static void execute_move_request(gpointer data, gpointer user_data) {
+    FileMoveRequest *request = (FileMoveRequest *)data;
+    (void)user_data;
+
+    gchar *dest_dir = g_path_get_dirname(request->dest_path);
+    if (!g_mkdir_with_parents(dest_dir, 0755)) {
+        if (errno != EEXIST) {
+            g_warning("Failed to create directory %s for queued move: %s", dest_dir, g_strerror(errno));
+        }
+    }
+    SAFE_FREE(dest_dir);
+
+    GError *move_error = NULL;
+    GFile *src_file = g_file_new_for_path(request->src_path);
+    GFile *dest_file = g_file_new_for_path(request->dest_path);
+
+    if (!g_file_move(src_file, dest_file, G_FILE_COPY_OVERWRITE, NULL, NULL, NULL, &move_error)) {
+        g_warning("Queued move failed (%s): %s -> %s: %s",
+                  request->description, request->src_path, request->dest_path,
+                  move_error ? move_error->message : "N/A");
+        if (move_error) g_error_free(move_error);
+        g_idle_add(file_move_failed_idle, request);
+    } else {
+        g_print("  Queued move done (%s): %s -> %s\n",
+                request->description, request->src_path, request->dest_path);
+        file_move_request_free(request);
+    }
+
+    g_object_unref(src_file);
+    g_object_unref(dest_file);
+}
+
+/**
+ * @brief Queues a move on the single-threaded move worker.
+ *
+ * One exclusive worker thread drains the queue in submission order, so two
+ * operations on the same source file can never reorder (a remove followed by
+ * a re-add of the same PDF is processed strictly in click order). The GUI
+ * side never blocks on the filesystem — important when the archive lives on
+ * NFS and a cross-directory move takes seconds.
+ */
+void file_move_queue_submit(const gchar *src_path, const gchar *dest_path, const gchar *description) {
+    if (!move_pool) {
+        GError *pool_error = NULL;
+        move_pool = g_thread_pool_new(execute_move_request, NULL, 1, TRUE, &pool_error);
+        if (!move_pool) {
+            g_warning("Could not create move worker: %s. Moving synchronously.",
+                      pool_error ? pool_error->message : "N/A");
+            if (pool_error) g_error_free(pool_error);
+        }
+    }
+
+    FileMoveRequest *request = g_new0(FileMoveRequest, 1);
+    request->src_path = g_strdup(src_path);
+    request->dest_path = g_strdup(dest_path);
+    request->description = g_strdup(description);
+
+    // The monitor must not treat our own archival as an external event.
+    category_monitors_note_self_write(request->src_path);
+
+    if (move_pool) {
+        g_thread_pool_push(move_pool, request, NULL);
+    } else {
+        execute_move_request(request, NULL);
+    }
+}
+
+void on_remove_pdf_entry(GtkWidget *button, PdfEntry *entry) {
+    (void)button;
+
+    g_print("Removing PDF entry: %s\n", entry->file_path ? entry->file_path : "N/A");
+
+    GtkWidget *row = NULL;
+    CategorySection *current_section = NULL;
+    gint category_index = -1;
+    const gchar *professor = NULL;
+
+    row = gtk_widget_get_parent(entry->box);
+    if (row && !GTK_IS_LIST_BOX_ROW(row)) {
+        row = NULL;
+    }
+    if (entry->category_index >= 0 && entry->category_index < global_num_categories) {
+        category_index = entry->category_index;
+        current_section = &global_sections[category_index];
+    }
+
+    professor = gtk_combo_box_text_get_active_text(GTK_COMBO_BOX_TEXT(professor_combo));
+
+    if (professor && entry->file_path && is_valid_path(entry->file_path) && g_file_test(entry->file_path, G_FILE_TEST_EXISTS) && current_section) {
+        gchar *professor_base_dir = g_strdup("./");
+        gchar *dest_category_dir = g_strdup_printf("%s%s/%s", professor_base_dir, professor, global_categories[category_index]);
+        gchar *old_files_dir = g_strdup_printf("%s/old_files", dest_category_dir);
+
+        gchar *original_basename = g_path_get_basename(entry->file_path);
+        gchar *old_file_dest_path = g_strdup_printf("%s/%s", old_files_dir, original_basename);
+
+        // Queue the archival; the row disappears immediately and the worker
+        // does the (possibly slow, NFS) move off the main thread.
+        g_print("  Queuing move of %s to %s due to 'Remover' button click.\n", entry->file_path, old_file_dest_path);
+        file_move_queue_submit(entry->file_path, old_file_dest_path, "Remover");
+
+        SAFE_FREE(original_basename);
+        SAFE_FREE(old_file_dest_path);
+        SAFE_FREE(old_files_dir);
+        SAFE_FREE(dest_category_dir);
+        SAFE_FREE(professor_base_dir);
+    } else {
+        if (!professor) {
+            g_warning("No professor selected. Cannot determine 'old_files' destination for removal. Skipping file move.");
+        } else if (!entry->file_path || !g_file_test(entry->file_path, G_FILE_TEST_EXISTS)) {
+            g_print("File %s does not exist or file_path is NULL. Skipping file move to old_files.\n", entry->file_path ? entry->file_path : "N/A");
+        } else if (!current_section) {
+            g_warning("Entry has no valid category index. Skipping file move.");
+        }
+    }
+
+    if (current_section) {
+        g_ptr_array_remove(current_section->entries, entry);
+        g_ptr_array_remove(current_section->unmaterialized, entry);
+        category_stats_entry_removed(category_index, entry);
+        gtk_list_box_invalidate_sort(GTK_LIST_BOX(current_section->list));
+    }
+
+    if (row) {
+        gtk_widget_destroy(GTK_WIDGET(row));
+        g_print("PDF entry removed from GUI. PdfEntry struct will be freed by GDestroyNotify.\n");
+    } else {
+        g_warning("GUI context (row) invalid for full GUI removal. PdfEntry struct will not be automatically freed by GTK.");
+    }
+}
+
+/**
+ * @brief Callback for professor selection. Clears old entries, loads new.
+ */
+gboolean on_professor_selected(GtkComboBox *combo_box, gpointer user_data) {
+    (void)user_data;
+
+    ensure_category_gui();
+
+    const gchar *professor = gtk_combo_box_text_get_active_text(GTK_COMBO_BOX_TEXT(combo_box));
+
+    if (preview_report_btn) {
+        gtk_widget_hide(preview_report_btn);
+    }
+
+    gtk_label_set_text(GTK_LABEL(status_label), "Carregando informações do professor...");
+    gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(progress_bar), 0.0);
+    gchar *progress_text_0 = g_strdup_printf("%d%%", 0);
+    gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progress_bar), progress_text_0);
+    SAFE_FREE(progress_text_0);
+    g_main_context_iteration(NULL, FALSE);
+
+    // Capture the outgoing professor's state before tearing it down, so
+    // flipping back is a snapshot replay instead of a rescan.
+    if (snapshot_active_professor && g_strcmp0(snapshot_active_professor, professor) != 0) {
+        professor_snapshot_store(snapshot_active_professor);
+    }
+    SAFE_FREE(snapshot_active_professor);
+
+    // Invalidate any in-flight exiftool reads before freeing their entries.
+    pdf_load_generation++;
+    pdf_loads_outstanding = 0;
+    pdf_loads_total = 0;
+    category_monitors_stop();
+
+    for (gint i = 0; i < global_num_categories; i++) {
+        if (global_sections[i].entries) {
+            for (guint j = 0; j < global_sections[i].entries->len; j++) {
+                PdfEntry *entry = g_ptr_array_index(global_sections[i].entries, j);
+                if (entry && !entry->row) {
+                    pdf_entry_destroy_notify(entry);
+                }
+            }
+        }
+
+        GList *children = gtk_container_get_children(GTK_CONTAINER(global_sections[i].list));
+        for (GList *l = children; l != NULL; l = g_list_next(l)) {
+            gtk_widget_destroy(GTK_WIDGET(l->data));
+        }
+        g_list_free(children);
+
+        // Keep the arrays allocated; the next professor load appends into them.
+        if (global_sections[i].entries) {
+            g_ptr_array_set_size(global_sections[i].entries, 0);
+        }
+        if (global_sections[i].unmaterialized) {
+            g_ptr_array_set_size(global_sections[i].unmaterialized, 0);
+        }
+    }
+
+    SAFE_FREE(global_max_category_counters);
+    global_max_category_counters = g_new0(gint, global_num_categories);
+    SAFE_FREE(global_category_total_bytes);
+    global_category_total_bytes = g_new0(gint64, global_num_categories);
+    category_stats_reset();
+
+    // Every entry above is gone; drop their strings in one sweep.
+    session_arena_reset();
+
+    if (!professor) {
+        g_print("No professor selected or selection cleared. All entries cleared.\n");
+        gtk_label_set_text(GTK_LABEL(status_label), "Pronto.");
+        gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(progress_bar), 0.0);
+        gchar *progress_text_0_again = g_strdup_printf("%d%%", 0);
+        gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progress_bar), progress_text_0_again);
+        SAFE_FREE(progress_text_0_again);
+        g_main_context_iteration(NULL, FALSE);
+        return G_SOURCE_REMOVE;
+    }
+
+    if (professor_snapshot_restore(professor)) {
+        snapshot_active_professor = g_strdup(professor);
+
+        for (gint i = 0; i < global_num_categories; i++) {
+            gtk_list_box_set_sort_func(GTK_LIST_BOX(global_sections[i].list), (GtkListBoxSortFunc)compare_pdf_entries_by_counter, NULL, NULL);
+            gtk_list_box_invalidate_sort(GTK_LIST_BOX(global_sections[i].list));
+        }
+        category_monitors_start(professor);
+
+        gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(progress_bar), 0.2);
+        gchar *progress_text_20 = g_strdup_printf("%d%%", 20);
+        gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progress_bar), progress_text_20);
+        SAFE_FREE(progress_text_20);
+        pdf_load_completed_ui();
+
+        return G_SOURCE_REMOVE;
+    }
+
+    gchar *exiftool_path = g_find_program_in_path("exiftool");
+    if (!exiftool_path) {
+        GtkWidget *dialog = gtk_message_dialog_new(NULL,
+                                                   GTK_DIALOG_MODAL,
+                                                   GTK_MESSAGE_ERROR,
+                                                   GTK_BUTTONS_OK,
+                                                   "Erro: O programa 'exiftool' não foi encontrado no seu PATH.\n"
+                                                   "Por favor, instale-o (sudo apt install libimage-exiftool-perl) e tente novamente.");
+        gtk_dialog_run(GTK_DIALOG(dialog));
+        gtk_widget_destroy(dialog);
+        gtk_label_set_text(GTK_LABEL(status_label), "Erro: exiftool não encontrado.");
+        gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(progress_bar), 0.0);
+        gchar *progress_text_error = g_strdup_printf("Erro!");
+        gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progress_bar), progress_text_error);
+        SAFE_FREE(progress_text_error);
+        g_main_context_iteration(NULL, FALSE);
+        SAFE_FREE(exiftool_path);
+        return G_SOURCE_REMOVE;
+    }
+    SAFE_FREE(exiftool_path);
+
+    g_print("Professor selected: %s. Initiating folder scan for all categories.\n", professor);
+
+    for (gint i = 0; i < global_num_categories; i++) {
+        gchar *professor_base_dir = g_strdup("./");
+        gchar *category_folder_path = g_strdup_printf("%s%s/%s", professor_base_dir, professor, global_categories[i]);
+
+        process_pdf_folder(category_folder_path, i);
+
+        gtk_list_box_set_sort_func(GTK_LIST_BOX(global_sections[i].list), (GtkListBoxSortFunc)compare_pdf_entries_by_counter, NULL, NULL);
+        gtk_list_box_invalidate_sort(GTK_LIST_BOX(global_sections[i].list));
+
+        SAFE_FREE(category_folder_path);
+        SAFE_FREE(professor_base_dir);
+    }
+
+    category_monitors_start(professor);
+    snapshot_active_professor = g_strdup(professor);
+
+    if (pdf_loads_outstanding > 0) {
+        // Cached entries were applied synchronously above; the status shows
+        // only the reads that are still waiting on exiftool.
+        gchar *loading_text = g_strdup_printf("Carregamento iniciado. Aguardando metadados de %d PDF(s)...",
+                                              pdf_loads_outstanding);
+        gtk_label_set_text(GTK_LABEL(status_label), loading_text);
+        SAFE_FREE(loading_text);
+        g_main_context_iteration(NULL, FALSE);
+    } else if (pdf_loads_total == 0) {
+        // Nothing was queued at all (no PDFs, or everything came from the
+        // cache and already drove the completed state).
+        gtk_label_set_text(GTK_LABEL(status_label), "Carregamento concluído. Pronto para gerar relatório.");
+        gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(progress_bar), 0.2);
+        gchar *progress_text_20 = g_strdup_printf("%d%%", 20);
+        gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progress_bar), progress_text_20);
+        SAFE_FREE(progress_text_20);
+        g_main_context_iteration(NULL, FALSE);
+    }
+
+    return G_SOURCE_REMOVE;
+}
+
+/**
+ * @brief Opens the selected category folder in the system file manager.
+ */
+void on_open_category_folder(GtkWidget *button, gpointer user_data) {
+    (void)user_data;
+
+    gint category_index = GPOINTER_TO_INT(g_object_get_data(G_OBJECT(button), "category-index"));
+
+    const gchar *professor = gtk_combo_box_text_get_active_text(GTK_COMBO_BOX_TEXT(professor_combo));
+    if (!professor || g_strcmp0(professor, "") == 0) {
+        GtkWidget *dialog = gtk_message_dialog_new(NULL,
+                                                   GTK_DIALOG_MODAL,
+                                                   GTK_MESSAGE_ERROR,
+                                                   GTK_BUTTONS_OK,
+                                                   "Por favor, selecione um professor para abrir a pasta da categoria.");
+        gtk_dialog_run(GTK_DIALOG(dialog));
+        gtk_widget_destroy(dialog);
+        return;
+    }
+
+    if (category_index < 0 || category_index >= global_num_categories || !global_categories[category_index]) {
+        g_warning("Invalid category index provided to on_open_category_folder: %d", category_index);
+        GtkWidget *dialog = gtk_message_dialog_new(NULL,
+                                                   GTK_DIALOG_MODAL,
+                                                   GTK_MESSAGE_ERROR,
+                                                   GTK_BUTTONS_OK,
+                                                   "Erro interno: Categoria inválida para abrir a pasta.");
+        gtk_dialog_run(GTK_DIALOG(dialog));
+        gtk_widget_destroy(dialog);
+        return;
+    }
+
+    gchar *professor_base_dir = g_strdup("./");
+    gchar *category_folder_path = g_strdup_printf("%s%s/%s", professor_base_dir, professor, global_categories[category_index]);
+
+    g_print("Attempting to open category folder: %s\n", category_folder_path);
+
+    if (!is_valid_path(category_folder_path)) {
+        g_warning("Invalid category folder path: %s", category_folder_path);
+        GtkWidget *dialog = gtk_message_dialog_new(NULL,
+                                                   GTK_DIALOG_MODAL,
+                                                   GTK_MESSAGE_ERROR,
+                                                   GTK_BUTTONS_OK,
+                                                   "Caminho inválido para a pasta da categoria: %s", category_folder_path);
+        gtk_dialog_run(GTK_DIALOG(dialog));
+        gtk_widget_destroy(dialog);
+        SAFE_FREE(category_folder_path);
+        SAFE_FREE(professor_base_dir);
+        return;
+    }
+
+
+    if (!g_file_test(category_folder_path, G_FILE_TEST_IS_DIR)) {
+        g_warning("Category folder does not exist: %s", category_folder_path);
+        GtkWidget *dialog = gtk_message_dialog_new(NULL,
+                                                   GTK_DIALOG_MODAL,
+                                                   GTK_MESSAGE_WARNING,
+                                                   GTK_BUTTONS_OK,
+                                                   "A pasta para a categoria '%s' do professor '%s' não existe.\n"
+                                                   "Por favor, use o botão 'Criar Pasta do Professor' para criá-la.",
+                                                   global_categories[category_index], professor);
+        gtk_dialog_run(GTK_DIALOG(dialog));
+        gtk_widget_destroy(dialog);
+        SAFE_FREE(category_folder_path);
+        SAFE_FREE(professor_base_dir);
+        return;
+    }
+
+    GError *spawn_error = NULL;
+    gchar *command_line = g_strdup_printf("xdg-open \"%s\"", category_folder_path);
+
+    if (!g_spawn_command_line_async(command_line, &spawn_error)) {
+        GtkWidget *dialog = gtk_message_dialog_new(NULL,
+                                                   GTK_DIALOG_MODAL,
+                                                   GTK_MESSAGE_ERROR,
+                                                   GTK_BUTTONS_OK,
+                                                   "Falha ao abrir a pasta: %s", spawn_error ? spawn_error->message : "N/A");
+        gtk_dialog_run(GTK_DIALOG(dialog));
+        gtk_widget_destroy(dialog);
+        if (spawn_error) g_error_free(spawn_error);
+    } else {
+        g_print("Category folder opened successfully.\n");
+    }
+
+    SAFE_FREE(command_line);
+    SAFE_FREE(category_folder_path);
+    SAFE_FREE(professor_base_dir);
+}
+
+#define PDF_SCAN_ENUM_BATCH 100   /* GFileInfos fetched per enumerator round-trip */
+
+/**
+ * @brief Scans a folder for PDF files, creates PdfEntries, and adds to GUI.
+ */
+void process_pdf_folder(const gchar *folder_path, gint category_index) {
+    g_print("Starting PDF folder scan in: %s for category index %d\n", folder_path, category_index);
+    gint64 scan_start = TRACE_BEGIN(TRACE_SCAN);
+
+    if (!is_valid_path(folder_path)) {
+        g_warning("Invalid folder path provided to process_pdf_folder: %s", folder_path);
+        return;
+    }
+
+    // Collect all read operations for this folder and submit them as one
+    // batched exiftool invocation instead of one process per file.
+    GPtrArray *pending_reads = g_ptr_array_new();
+
+    // Consult the sidecar cache first: unchanged files (same mtime and size)
+    // are populated synchronously with zero subprocesses.
+    GHashTable *metadata_cache = metadata_cache_load(folder_path);
+    guint cache_hits = 0;
+
+    // One enumerator delivers name, type, size and mtime together in batched
+    // round-trips, instead of a separate stat per directory entry — the
+    // difference between one and N server calls on NFS-mounted archives.
+    GFile *folder = g_file_new_for_path(folder_path);
+    GError *enum_error = NULL;
+    GFileEnumerator *enumerator = g_file_enumerate_children(folder,
+                                                            G_FILE_ATTRIBUTE_STANDARD_NAME ","
+                                                            G_FILE_ATTRIBUTE_STANDARD_TYPE ","
+                                                            G_FILE_ATTRIBUTE_STANDARD_SIZE ","
+                                                            G_FILE_ATTRIBUTE_TIME_MODIFIED,
+                                                            G_FILE_QUERY_INFO_NONE, NULL, &enum_error);
+    if (enumerator) {
+        while (TRUE) {
+            GList *infos = g_file_enumerator_next_files(enumerator, PDF_SCAN_ENUM_BATCH, NULL, &enum_error);
+            if (!infos) {
+                if (enum_error) {
+                    g_warning("Error enumerating %s: %s", folder_path, enum_error->message);
+                    g_clear_error(&enum_error);
+                }
+                break;
+            }
+
+            for (GList *l = infos; l != NULL; l = g_list_next(l)) {
+                GFileInfo *file_info = (GFileInfo *)l->data;
+                const gchar *name = g_file_info_get_name(file_info);
+
+                if (g_file_info_get_file_type(file_info) != G_FILE_TYPE_REGULAR ||
+                    !filename_has_pdf_suffix(name)) {
+                    g_object_unref(file_info);
+                    continue;
+                }
+
+                gchar *full_path = g_build_filename(folder_path, name, NULL);
+                if (!is_valid_path(full_path)) {
+                    g_warning("Skipping invalid file path: %s", full_path);
+                    SAFE_FREE(full_path);
+                    g_object_unref(file_info);
+                    continue;
+                }
+
+                trace_log(TRACE_SCAN, "found PDF: %s", full_path);
+                trace_count(TRACE_COUNT_FILES_SCANNED, 1);
+
+                PdfEntry *new_entry = create_pdf_entry();
+                new_entry->file_path = session_strdup(full_path);
+                new_entry->file_size = g_file_info_get_size(file_info);
+                pdf_entry_set_title(new_entry, "Carregando título...");
+                pdf_entry_set_year(new_entry, "Carregando ano...");
+                pdf_entry_set_category(new_entry, "Carregando categoria...");
+
+                // Model only; the row widget is materialized lazily.
+                add_pdf_entry_to_gui(category_index, new_entry, NULL);
+
+                ExiftoolReadOperation *op = g_malloc0(sizeof(ExiftoolReadOperation));
+                op->file_path = full_path;   // ownership transferred
+                op->entry = new_entry;
+                op->generation = pdf_load_generation;
+                op->category_index = category_index;
+                op->is_new_file_selection = FALSE;
+                op->file_size = new_entry->file_size;
+                op->file_mtime = (gint64)g_file_info_get_attribute_uint64(file_info, G_FILE_ATTRIBUTE_TIME_MODIFIED);
+
+                pdf_load_track_queued();
+
+                MetadataCacheEntry *cached = g_hash_table_lookup(metadata_cache, name);
+                if (cached && cached->mtime == op->file_mtime && cached->size == op->file_size) {
+                    op->from_cache = TRUE;
+                    pdf_entry_populate_metadata(op, cached->title, cached->year, cached->category,
+                                                cached->page_count);
+                    cache_hits++;
+                } else {
+                    g_ptr_array_add(pending_reads, op);
+                }
+
+                g_object_unref(file_info);
+            }
+            g_list_free(infos);
+        }
+        g_object_unref(enumerator);
+    } else {
+        g_warning("Could not open category directory: %s (%s). Skipping this category.",
+                  folder_path, enum_error ? enum_error->message : "N/A");
+        g_clear_error(&enum_error);
+    }
+    g_object_unref(folder);
+
+    if (cache_hits > 0) {
+        g_print("  Metadata cache: %u hit(s) in %s, %u file(s) need exiftool.\n",
+                cache_hits, folder_path, pending_reads->len);
+        trace_count(TRACE_COUNT_CACHE_HITS, cache_hits);
+    }
+    g_hash_table_destroy(metadata_cache);
+
+    TRACE_END(TRACE_SCAN, scan_start);
+
+    // Build widgets for the first screenful; the rest follow on scroll.
+    category_section_materialize_rows(category_index, PDF_ROWS_MATERIALIZE_CHUNK);
+
+    if (pending_reads->len == 0) {
+        g_ptr_array_free(pending_reads, TRUE);
+        return;
+    }
+
+    if (exiftool_batch_read(pending_reads)) {
+        return; // batch owns the operations now
+    }
+
+    // Batch spawn failed: fall back to the daemon / per-file paths.
+    for (guint i = 0; i < pending_reads->len; i++) {
+        ExiftoolReadOperation *op = g_ptr_array_index(pending_reads, i);
+        if (!exiftool_daemon_submit(op) && !spawn_exiftool_read(op)) {
+            g_warning("Could not start exiftool for %s", op->file_path);
+            exiftool_apply_metadata(op, NULL, FALSE, "exiftool unavailable");
+        }
+    }
+    g_ptr_array_free(pending_reads, TRUE);
+}
+
+// =============================================================================
+// WRITE-AHEAD SAVE JOURNAL
+// =============================================================================
+
+// Append-only journal for the parallel save engine. Every copy, archive
+// move and metadata write is recorded (fsync'd) as an INTENT before it
+// executes and marked DONE afterwards, so a run killed midway leaves a
+// precise record instead of requiring directory archaeology. On the next
+// startup an incomplete journal is detected and the user can roll the
+// unfinished operations back or keep them. A cleanly committed journal is
+// renamed to SAVE_JOURNAL_LAST_PATH, where it doubles as the change
+// manifest of the last completed batch.
+//
+// Record format (tab-separated, one per line):
+//   BATCH  <professor> <total-jobs>
+//   INTENT <id> <op> <src> <dest>      op: copy | move | metadata-batch
+//   DONE   <id>
+//   COMMIT
+
+#define SAVE_JOURNAL_PATH "./.save_journal"
+#define SAVE_JOURNAL_LAST_PATH "./.save_journal.last"
+
+static FILE *save_journal_fp = NULL;
+static GMutex save_journal_lock;      /* records come from the save workers */
+static gint save_journal_next_id = 1;
+static gint save_journal_outstanding = 0;
+
+/**
+ * @brief Appends one journal line and forces it to disk.
+ */
+static void save_journal_append(const gchar *format, ...) {
+    if (!save_journal_fp) return;
+
+    va_list args;
+    va_start(args, format);
+    gchar *line = g_strdup_vprintf(format, args);
+    va_end(args);
+
+    g_mutex_lock(&save_journal_lock);
+    fprintf(save_journal_fp, "%s\n", line);
+    fflush(save_journal_fp);
+    fsync(fileno(save_journal_fp));
+    g_mutex_unlock(&save_journal_lock);
+    SAFE_FREE(line);
+}
+
+/**
+ * @brief Opens a fresh journal for a starting save batch.
+ */
+void save_journal_open(const gchar *professor, gint total_jobs) {
+    if (save_journal_fp) {
+        g_warning("Save journal already open; not starting a second one.");
+        return;
+    }
+    save_journal_fp = fopen(SAVE_JOURNAL_PATH, "w");
+    if (!save_journal_fp) {
+        g_warning("Could not open save journal '%s': %s (saving without journal)",
+                  SAVE_JOURNAL_PATH, g_strerror(errno));
+        return;
+    }
+    save_journal_next_id = 1;
+    save_journal_outstanding = 0;
+    save_journal_append("BATCH\t%s\t%d", professor, total_jobs);
+}
+
+/**
+ * @brief Records an operation about to execute. Returns its id (0 with
+ * the journal closed -- callers pass that straight to save_journal_done,
+ * which ignores it).
+ */
+gint save_journal_intent(const gchar *op, const gchar *src, const gchar *dest) {
+    if (!save_journal_fp) return 0;
+
+    g_mutex_lock(&save_journal_lock);
+    gint id = save_journal_next_id++;
+    save_journal_outstanding++;
+    g_mutex_unlock(&save_journal_lock);
+
+    save_journal_append("INTENT\t%d\t%s\t%s\t%s", id, op, src ? src : "-", dest ? dest : "-");
+    return id;
+}
+
+/**
+ * @brief Marks a journaled operation as completed.
+ */
+void save_journal_done(gint id) {
+    if (!save_journal_fp || id == 0) return;
+
+    g_mutex_lock(&save_journal_lock);
+    save_journal_outstanding--;
+    g_mutex_unlock(&save_journal_lock);
+
+    save_journal_append("DONE\t%d", id);
+}
+
+/**
+ * @brief Closes the journal at batch end. Fully completed batches are
+ * committed and renamed to the .last manifest; batches with unfinished
+ * operations (failed jobs) keep the journal in place for the startup
+ * recovery check.
+ */
+void save_journal_close(void) {
+    if (!save_journal_fp) return;
+
+    gboolean complete = (save_journal_outstanding == 0);
+    if (complete) {
+        save_journal_append("COMMIT");
+    } else {
+        g_warning("Save batch finished with %d operation(s) not marked done; keeping journal %s.",
+                  save_journal_outstanding, SAVE_JOURNAL_PATH);
+    }
+    fclose(save_journal_fp);
+    save_journal_fp = NULL;
+
+    if (complete) {
+        if (g_rename(SAVE_JOURNAL_PATH, SAVE_JOURNAL_LAST_PATH) != 0) {
+            g_warning("Could not rename completed save journal: %s", g_strerror(errno));
+        }
+    }
+}
+
+typedef struct {
+    gint id;
+    gchar *op;
+    gchar *src;
+    gchar *dest;
+} JournalRecord;
+
+static void journal_record_free(gpointer data) {
+    JournalRecord *record = data;
+    SAFE_FREE(record->op);
+    SAFE_FREE(record->src);
+    SAFE_FREE(record->dest);
+    SAFE_FREE(record);
+}
+
+/**
+ * @brief Parses a journal into its still-incomplete operations (INTENT
+ * records without a DONE). Returns NULL when the journal is absent or
+ * committed clean.
+ */
+static GPtrArray* save_journal_parse_incomplete(const gchar *path) {
+    gchar *contents = NULL;
+    if (!g_file_get_contents(path, &contents, NULL, NULL)) {
+        return NULL;
+    }
+
+    GHashTable *pending = g_hash_table_new_full(g_direct_hash, g_direct_equal,
+                                                NULL, journal_record_free);
+    gboolean committed = FALSE;
+
+    gchar **lines = g_strsplit(contents, "\n", -1);
+    SAFE_FREE(contents);
+    for (gint i = 0; lines[i] != NULL; i++) {
+        gchar **fields = g_strsplit(lines[i], "\t", -1);
+        guint n_fields = g_strv_length(fields);
+
+        if (n_fields >= 5 && g_strcmp0(fields[0], "INTENT") == 0) {
+            JournalRecord *record = g_new0(JournalRecord, 1);
+            record->id = atoi(fields[1]);
+            record->op = g_strdup(fields[2]);
+            record->src = g_strdup(fields[3]);
+            record->dest = g_strdup(fields[4]);
+            g_hash_table_insert(pending, GINT_TO_POINTER(record->id), record);
+        } else if (n_fields >= 2 && g_strcmp0(fields[0], "DONE") == 0) {
+            g_hash_table_remove(pending, GINT_TO_POINTER(atoi(fields[1])));
+        } else if (g_strcmp0(fields[0], "COMMIT") == 0) {
+            committed = TRUE;
+        }
+        g_strfreev(fields);
+    }
+    g_strfreev(lines);
+
+    if (committed || g_hash_table_size(pending) == 0) {
+        g_hash_table_destroy(pending);
+        return NULL;
+    }
+
+    GPtrArray *incomplete = g_ptr_array_new_with_free_func(journal_record_free);
+    GHashTableIter iter;
+    gpointer value;
+    g_hash_table_iter_init(&iter, pending);
+    while (g_hash_table_iter_next(&iter, NULL, &value)) {
+        g_hash_table_iter_steal(&iter);
+        g_ptr_array_add(incomplete, value);
+    }
+    g_hash_table_destroy(pending);
+    return incomplete;
+}
+
+/**
+ * @brief Rolls one unfinished operation back to its pre-save state.
+ */
+static void save_journal_rollback_record(JournalRecord *record) {
+    if (g_strcmp0(record->op, "copy") == 0) {
+        // The copy may be partial; the original is untouched at src.
+        if (g_file_test(record->dest, G_FILE_TEST_EXISTS)) {
+            if (g_unlink(record->dest) == 0) {
+                g_print("  Journal rollback: removed incomplete copy %s\n", record->dest);
+            } else {
+                g_warning("  Journal rollback: could not remove %s: %s", record->dest, g_strerror(errno));
+            }
+        }
+    } else if (g_strcmp0(record->op, "move") == 0) {
+        // Archive move: put the file back where the entry expects it.
+        if (g_file_test(record->dest, G_FILE_TEST_EXISTS) &&
+            !g_file_test(record->src, G_FILE_TEST_EXISTS)) {
+            if (g_rename(record->dest, record->src) == 0) {
+                g_print("  Journal rollback: restored %s\n", record->src);
+            } else {
+                g_warning("  Journal rollback: could not restore %s: %s", record->src, g_strerror(errno));
+            }
+        }
+    } else {
+        // metadata-batch: exiftool writes in place; nothing to undo safely.
+        g_print("  Journal rollback: metadata write %s left as-is (rewritten on next save).\n",
+                record->dest);
+    }
+}
+
+/**
+ * @brief Startup check: detects a journal left by an interrupted save and
+ * offers to roll the unfinished operations back or keep them.
+ */
+void save_journal_recover(void) {
+    GPtrArray *incomplete = save_journal_parse_incomplete(SAVE_JOURNAL_PATH);
+    if (!incomplete) {
+        // Absent, or complete (e.g. killed between last DONE and COMMIT).
+        if (g_file_test(SAVE_JOURNAL_PATH, G_FILE_TEST_EXISTS)) {
+            g_rename(SAVE_JOURNAL_PATH, SAVE_JOURNAL_LAST_PATH);
+        }
+        return;
+    }
+
+    g_print("Incomplete save journal found: %u unfinished operation(s).\n", incomplete->len);
+
+    GtkWidget *dialog = gtk_message_dialog_new(NULL,
+                                               GTK_DIALOG_MODAL,
+                                               GTK_MESSAGE_WARNING,
+                                               GTK_BUTTONS_YES_NO,
+                                               "Um salvamento anterior foi interrompido no meio: "
+                                               "%u operação(ões) podem estar incompletas.\n\n"
+                                               "Deseja reverter as alterações incompletas? "
+                                               "(\"Não\" mantém os arquivos como estão.)",
+                                               incomplete->len);
+    gint response = gtk_dialog_run(GTK_DIALOG(dialog));
+    gtk_widget_destroy(dialog);
+
+    if (response == GTK_RESPONSE_YES) {
+        for (guint i = 0; i < incomplete->len; i++) {
+            save_journal_rollback_record(g_ptr_array_index(incomplete, i));
+        }
+        g_unlink(SAVE_JOURNAL_PATH);
+        g_print("Journal rollback finished.\n");
+    } else {
+        g_rename(SAVE_JOURNAL_PATH, SAVE_JOURNAL_LAST_PATH);
+        g_print("Incomplete journal kept as %s.\n", SAVE_JOURNAL_LAST_PATH);
+    }
+    g_ptr_array_free(incomplete, TRUE);
+}
+
+// =============================================================================
+// ASYNCHRONOUS SAVE PIPELINE
+// =============================================================================
+
+static GThreadPool *save_pool = NULL;
+static SaveBatch *active_save_batch = NULL;
+
+static void execute_save_job(gpointer data, gpointer user_data);
+static gboolean save_job_progress_idle(gpointer data);
+
+/**
+ * @brief Returns the shared save worker pool, creating it on first use.
+ *
+ * Parallelism defaults to the number of online processors and can be
+ * overridden with the REPORT_GUI_SAVE_JOBS environment variable.
+ */
+static GThreadPool* save_pool_get(void) {
+    if (save_pool) return save_pool;
+
+    gint max_threads = (gint)g_get_num_processors();
+    const gchar *env_jobs = g_getenv("REPORT_GUI_SAVE_JOBS");
+    if (env_jobs && atoi(env_jobs) > 0) {
+        max_threads = atoi(env_jobs);
+    }
+
+    GError *pool_error = NULL;
+    save_pool = g_thread_pool_new(execute_save_job, NULL, max_threads, FALSE, &pool_error);
+    if (!save_pool) {
+        g_warning("Failed to create save worker pool: %s", pool_error ? pool_error->message : "N/A");
+        if (pool_error) g_error_free(pool_error);
+    } else {
+        g_print("Save worker pool created with %d threads.\n", max_threads);
+    }
+    return save_pool;
+}
+
+/**
+ * @brief Frees one save job and everything it owns.
+ */
+static void save_job_free(SaveJob *job) {
+    SAFE_FREE(job->src_path);
+    SAFE_FREE(job->dest_category_dir);
+    SAFE_FREE(job->dest_file_name);
+    SAFE_FREE(job->dest_file_path);
+    SAFE_FREE(job->title);
+    SAFE_FREE(job->year);
+    SAFE_FREE(job->category);
+    g_free(job);
+}
+
+/**
+ * @brief Resolves everything a save job needs while still on the main thread.
+ *
+ * Reads the entry's widgets, assigns the filename counter and creates the
+ * destination directory. Counter assignment stays deterministic because all
+ * jobs are prepared serially, in category/entry order, before any worker
+ * starts. Returns NULL for entries that cannot be saved.
+ */
+SaveJob* prepare_save_job(PdfEntry *entry, const gchar *professor_name, gint category_index, SaveBatch *batch) {
+    // Accessors, not raw widget reads: entries whose rows were never
+    // materialized (below the scrolled viewport) must still be saved.
+    const gchar *title_raw = pdf_entry_get_title(entry);
+    const gchar *year = pdf_entry_get_year(entry);
+    const gchar *manual_counter_str = pdf_entry_get_counter(entry);
+    const gchar *current_category_text = pdf_entry_get_category(entry);
+
+    if (!entry->file_path || g_strcmp0(entry->file_path, "") == 0 || !is_valid_path(entry->file_path)) {
+        g_warning("Skipping entry in category '%s': No valid file selected.", global_categories[category_index]);
+        return NULL;
+    }
+    if (g_strcmp0(title_raw, "") == 0) {
+         g_warning("Skipping entry in category '%s' (file: %s): Title is empty.", global_categories[category_index], entry->file_path);
+         return NULL;
+    }
+    if (g_strcmp0(year, "") == 0) {
+         g_warning("Skipping entry in category '%s' (file: %s): Year is empty.", global_categories[category_index], entry->file_path);
+         return NULL;
+    }
+    if (g_strcmp0(current_category_text, "") == 0) {
+         g_warning("Skipping entry in category '%s' (file: %s): Category is empty.", global_categories[category_index], entry->file_path);
+         return NULL;
+    }
+
+    trace_log(TRACE_COPY, "preparing save for %s (title=\"%s\" year=\"%s\" category=\"%s\" counter=\"%s\")",
+              entry->file_path, title_raw, year, current_category_text, manual_counter_str);
+
+    gchar *sanitized_category_for_filename = sanitize_filename(current_category_text);
+
+    gchar *final_filename_no_ext = NULL;
+    gint current_counter = 0;
+    gboolean use_manual_counter_for_filename = FALSE;
+
+    if (manual_counter_str && g_strcmp0(manual_counter_str, "") != 0) {
+        gint parsed_counter = atoi(manual_counter_str);
+        if (parsed_counter > 0) {
+            current_counter = parsed_counter;
+            use_manual_counter_for_filename = TRUE;
+            trace_log(TRACE_COPY, "using manual counter: %02d", current_counter);
+        }
+    }
+
+    if (use_manual_counter_for_filename) {
+        final_filename_no_ext = g_strdup_printf("%02d_%s_%s", current_counter, sanitized_category_for_filename, year);
+    } else {
+        if (entry->has_original_counter && entry->original_detected_counter > 0) {
+            current_counter = entry->original_detected_counter;
+            trace_log(TRACE_COPY, "using detected original counter: %02d", current_counter);
+        } else {
+            global_max_category_counters[category_index]++;
+            current_counter = global_max_category_counters[category_index];
+            trace_log(TRACE_COPY, "assigning new counter: %02d", current_counter);
+        }
+        final_filename_no_ext = g_strdup_printf("%02d_%s_%s", current_counter, sanitized_category_for_filename, year);
+    }
+
+    gchar *professor_base_dir = g_strdup("./");
+    gchar *dest_category_dir = g_strdup_printf("%s%s/%s", professor_base_dir, professor_name, global_categories[category_index]);
+    trace_log(TRACE_COPY, "ensuring category directory exists: %s", dest_category_dir);
+
+    if (!is_valid_path(dest_category_dir)) {
+        g_warning("Invalid destination category directory path: %s", dest_category_dir);
+        SAFE_FREE(sanitized_category_for_filename);
+        SAFE_FREE(final_filename_no_ext);
+        SAFE_FREE(dest_category_dir);
+        SAFE_FREE(professor_base_dir);
+        return NULL;
+    }
+
+    if (!g_mkdir_with_parents(dest_category_dir, 0755)) {
+        if (errno != EEXIST) {
+            g_warning("Failed to create category directory: %s (%s)", dest_category_dir, g_strerror(errno));
+            SAFE_FREE(sanitized_category_for_filename);
+            SAFE_FREE(final_filename_no_ext);
+            SAFE_FREE(dest_category_dir);
+            SAFE_FREE(professor_base_dir);
+            return NULL;
+        }
+    }
+
+
+    gchar *dest_file_name = g_strdup_printf("%s.pdf", final_filename_no_ext);
+    gchar *dest_file_path = g_strdup_printf("%s/%s", dest_category_dir, dest_file_name);
+    trace_log(TRACE_COPY, "destination file path: %s", dest_file_path);
+
+    if (!is_valid_path(dest_file_path)) {
+        g_warning("Invalid destination file path: %s", dest_file_path);
+        SAFE_FREE(sanitized_category_for_filename);
+        SAFE_FREE(final_filename_no_ext);
+        SAFE_FREE(dest_file_name);
+        SAFE_FREE(dest_file_path);
+        SAFE_FREE(dest_category_dir);
+        SAFE_FREE(professor_base_dir);
+        return NULL;
+    }
+
+    gboolean filename_changed = (entry->original_filename_no_ext == NULL || g_strcmp0(final_filename_no_ext, entry->original_filename_no_ext) != 0);
+
+    SaveJob *job = g_new0(SaveJob, 1);
+    job->batch = batch;
+    job->src_path = g_strdup(entry->file_path);
+    job->dest_category_dir = dest_category_dir;
+    job->dest_file_name = dest_file_name;
+    job->dest_file_path = dest_file_path;
+    job->title = g_strdup(title_raw);
+    job->year = g_strdup(year);
+    job->category = g_strdup(current_category_text);
+    job->page_count = entry->page_count;
+    job->archive_original = filename_changed;
+    job->success = FALSE;
+
+    // The folder monitors must not re-import our own writes (or treat the
+    // archived original as an external deletion).
+    category_monitors_note_self_write(job->dest_file_path);
+    if (job->archive_original) {
+        category_monitors_note_self_write(job->src_path);
+    }
+
+    SAFE_FREE(sanitized_category_for_filename);
+    SAFE_FREE(final_filename_no_ext);
+    SAFE_FREE(professor_base_dir);
+
+    return job;
+}
+
+/**
+ * @brief Copies a PDF, preferring metadata-only clones over full data copies.
+ *
+ * On filesystems that support it (btrfs, XFS with reflink) FICLONE shares
+ * the source extents, so copying a 300MB scan costs no disk traffic at all.
+ * copy_file_range() is the second tier: it stays in the kernel and can still
+ * offload or server-side-copy. Only when both are unsupported does this fall
+ * back to g_file_copy(). Thread-safe; runs on the save pool workers.
+ */
+static gboolean save_copy_file(const gchar *src_path, const gchar *dest_path, GError **error) {
+#ifdef __linux__
+    gint src_fd = open(src_path, O_RDONLY);
+    if (src_fd >= 0) {
+        GStatBuf src_stat;
+        if (g_stat(src_path, &src_stat) == 0) {
+            gint dest_fd = open(dest_path, O_WRONLY | O_CREAT | O_TRUNC, src_stat.st_mode & 0777);
+            if (dest_fd >= 0) {
+#ifdef FICLONE
+                if (ioctl(dest_fd, FICLONE, src_fd) == 0) {
+                    close(dest_fd);
+                    close(src_fd);
+                    trace_log(TRACE_COPY, "cloned (reflink) %s -> %s", src_path, dest_path);
+                    return TRUE;
+                }
+#endif
+                off_t remaining = src_stat.st_size;
+                gboolean range_ok = TRUE;
+                while (remaining > 0) {
+                    ssize_t n = copy_file_range(src_fd, NULL, dest_fd, NULL, (size_t)remaining, 0);
+                    if (n <= 0) {
+                        range_ok = FALSE;
+                        break;
+                    }
+                    remaining -= n;
+                }
+                close(dest_fd);
+                if (range_ok && remaining == 0) {
+                    close(src_fd);
+                    trace_log(TRACE_COPY, "copied (copy_file_range) %s -> %s", src_path, dest_path);
+                    return TRUE;
+                }
+                // Partial output from a failed kernel copy; the fallback
+                // below recreates the destination from scratch.
+                g_unlink(dest_path);
+            }
+        }
+        close(src_fd);
+    }
+#endif
+
+    GFile *source_file = g_file_new_for_path(src_path);
+    GFile *destination_file = g_file_new_for_path(dest_path);
+    gboolean copied = g_file_copy(source_file, destination_file, G_FILE_COPY_OVERWRITE, NULL, NULL, NULL, error);
+    g_object_unref(source_file);
+    g_object_unref(destination_file);
+    return copied;
+}
+
+/**
+ * @brief Worker-side body of a save job: copy and original archival.
+ *
+ * Runs on the save pool, so it must not touch any GTK widget; everything it
+ * needs was resolved into the SaveJob on the main thread. The result is
+ * posted back through save_job_progress_idle().
+ */
+static void execute_save_job(gpointer data, gpointer user_data) {
+    SaveJob *job = (SaveJob *)data;
+    (void)user_data;
+
+    GError *copy_error = NULL;
+    gint copy_op = save_journal_intent("copy", job->src_path, job->dest_file_path);
+    gint64 copy_start = TRACE_BEGIN(TRACE_COPY);
+    gboolean copied = save_copy_file(job->src_path, job->dest_file_path, &copy_error);
+    TRACE_END(TRACE_COPY, copy_start);
+
+    if (!copied) {
+        g_warning("Failed to copy file from %s to %s: %s", job->src_path, job->dest_file_path, copy_error ? copy_error->message : "N/A");
+        if (copy_error) g_error_free(copy_error);
+        g_idle_add(save_job_progress_idle, job);
+        return;
+    }
+    save_journal_done(copy_op);
+    trace_log(TRACE_COPY, "file copied to: %s", job->dest_file_path);
+    if (trace_flags != 0) {
+        GStatBuf dest_stat;
+        if (g_stat(job->dest_file_path, &dest_stat) == 0) {
+            trace_count(TRACE_COUNT_BYTES_COPIED, (gint64)dest_stat.st_size);
+        }
+    }
+
+    if (job->archive_original && g_file_test(job->src_path, G_FILE_TEST_EXISTS)) {
+        gchar *old_files_dir = g_strdup_printf("%s/old_files", job->dest_category_dir);
+
+        if (!is_valid_path(old_files_dir)) {
+            g_warning("Invalid old_files directory path: %s", old_files_dir);
+            SAFE_FREE(old_files_dir);
+        } else {
+            if (!g_mkdir_with_parents(old_files_dir, 0755)) {
+                if (errno != EEXIST) {
+                    g_warning("Failed to create old_files directory: %s (%s)", old_files_dir, g_strerror(errno));
+                }
+            }
+
+            gchar *original_basename = g_path_get_basename(job->src_path);
+            gchar *old_file_dest_path = g_strdup_printf("%s/%s", old_files_dir, original_basename);
+
+            if (!is_valid_path(old_file_dest_path)) {
+                g_warning("Invalid old file destination path: %s", old_file_dest_path);
+            } else {
+                GError *move_error = NULL;
+                GFile *original_gfile_to_move = g_file_new_for_path(job->src_path);
+                GFile *old_dest_gfile = g_file_new_for_path(old_file_dest_path);
+
+                if (g_file_query_exists(original_gfile_to_move, NULL)) {
+                    gint move_op = save_journal_intent("move", job->src_path, old_file_dest_path);
+                    if (!g_file_move(original_gfile_to_move, old_dest_gfile, G_FILE_COPY_OVERWRITE, NULL, NULL, NULL, &move_error)) {
+                        g_warning("Failed to move original file from %s to %s: %s", job->src_path, old_file_dest_path, move_error ? move_error->message : "N/A");
+                        if (move_error) g_error_free(move_error);
+                    } else {
+                        save_journal_done(move_op);
+                        g_print("    Original file successfully moved to: %s\n", old_file_dest_path);
+                    }
+                } else {
+                    g_warning("Original file %s does not exist (perhaps already moved or deleted), skipping move to old_files.", job->src_path);
+                }
+
+                g_object_unref(original_gfile_to_move);
+                g_object_unref(old_dest_gfile);
+            }
+
+            SAFE_FREE(original_basename);
+            SAFE_FREE(old_file_dest_path);
+            SAFE_FREE(old_files_dir);
+        }
+    }
+
+    job->success = TRUE;
+    g_idle_add(save_job_progress_idle, job);
+}
+
+/**
+ * @brief Releases a finished batch: fires the callback, frees jobs and batch.
+ */
+static void save_batch_finish(SaveBatch *batch) {
+    save_journal_close();
+    active_save_batch = NULL;
+    if (batch->on_complete) {
+        batch->on_complete(batch);
+    }
+    if (batch->jobs) {
+        g_ptr_array_free(batch->jobs, TRUE);
+    }
+    SAFE_FREE(batch->argfile_path);
+    SAFE_FREE(batch->professor);
+    g_free(batch);
+}
+
+/**
+ * @brief Drain-done callback for the batched exiftool metadata write.
+ *
+ * Exiftool reports per-file problems on stderr as "Error: <reason> - <file>";
+ * those files keep their copies but are excluded from the sidecar cache so
+ * the next load re-reads them. Everything else is cached with its freshly
+ * written tags.
+ */
+static void save_batch_metadata_done(gint status, const gchar *stdout_buf, const gchar *stderr_buf, gpointer user_data) {
+    SaveBatch *batch = (SaveBatch *)user_data;
+
+    if (WIFEXITED(status) && WEXITSTATUS(status) <= 1) {
+        save_journal_done(batch->journal_metadata_op);
+    }
+
+    if (stdout_buf && *stdout_buf) {
+        g_print("  Batched exiftool write summary: %s\n", stdout_buf);
+    }
+    if (!WIFEXITED(status) || WEXITSTATUS(status) > 1) {
+        // Exit code 1 means "some files had errors" (reported per-file on
+        // stderr); anything beyond that is a hard failure of the whole run.
+        g_warning("Batched exiftool metadata write failed (status %d). Stderr: %s",
+                  status, stderr_buf && *stderr_buf ? stderr_buf : "(empty)");
+    }
+
+    GHashTable *failed_paths = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+    if (stderr_buf && *stderr_buf) {
+        gchar **lines = g_strsplit(stderr_buf, "\n", -1);
+        for (gint i = 0; lines[i]; i++) {
+            if (!g_str_has_prefix(lines[i], "Error")) continue;
+            const gchar *sep = strstr(lines[i], " - ");
+            if (sep) {
+                g_hash_table_add(failed_paths, g_strdup(sep + 3));
+            }
+            g_warning("Exiftool reported: %s", lines[i]);
+        }
+        g_strfreev(lines);
+    }
+
+    for (guint i = 0; i < batch->jobs->len; i++) {
+        SaveJob *job = g_ptr_array_index(batch->jobs, i);
+        if (!job->success) continue;
+        if (g_hash_table_contains(failed_paths, job->dest_file_path)) {
+            g_warning("Metadata not written for %s; skipping cache entry.", job->dest_file_path);
+            continue;
+        }
+
+        // Record the freshly written metadata in the sidecar cache so the
+        // next reload of this folder skips exiftool for this file.
+        GStatBuf dest_stat;
+        if (g_stat(job->dest_file_path, &dest_stat) == 0) {
+            metadata_cache_append(job->dest_category_dir, job->dest_file_name,
+                                  (gint64)dest_stat.st_mtime, (gint64)dest_stat.st_size,
+                                  job->title, job->year, job->category, job->page_count);
+        }
+    }
+    g_hash_table_destroy(failed_paths);
+
+    if (batch->argfile_path) {
+        g_unlink(batch->argfile_path);
+    }
+    save_batch_finish(batch);
+}
+
+/**
+ * @brief Writes Title/Year/Category for every copied file in one exiftool run.
+ *
+ * Builds an argfile with one '-execute'-separated section per file, so a
+ * 100-PDF save costs one Perl startup instead of 100. Falls through to
+ * save_batch_finish() directly when there is nothing to write or the spawn
+ * fails (copies are already on disk either way).
+ */
+static void save_batch_write_metadata(SaveBatch *batch) {
+    GString *argfile = g_string_new("");
+    guint writes = 0;
+
+    for (guint i = 0; i < batch->jobs->len; i++) {
+        SaveJob *job = g_ptr_array_index(batch->jobs, i);
+        if (!job->success) continue;
+        g_string_append_printf(argfile,
+                               "-charset\nutf8\n-Title=%s\n-Year=%s\n-Category=%s\n"
+                               "-overwrite_original_in_place\n%s\n-execute\n",
+                               job->title, job->year, job->category, job->dest_file_path);
+        writes++;
+    }
+
+    if (writes == 0) {
+        g_string_free(argfile, TRUE);
+        save_batch_finish(batch);
+        return;
+    }
+
+    GError *tmp_error = NULL;
+    gint argfile_fd = g_file_open_tmp("report_gui_save_args_XXXXXX", &batch->argfile_path, &tmp_error);
+    if (argfile_fd < 0) {
+        g_warning("Could not create exiftool argfile: %s", tmp_error ? tmp_error->message : "N/A");
+        if (tmp_error) g_error_free(tmp_error);
+        g_string_free(argfile, TRUE);
+        save_batch_finish(batch);
+        return;
+    }
+    if (write(argfile_fd, argfile->str, argfile->len) != (gssize)argfile->len) {
+        g_warning("Could not write exiftool argfile %s: %s", batch->argfile_path, g_strerror(errno));
+        close(argfile_fd);
+        g_unlink(batch->argfile_path);
+        g_string_free(argfile, TRUE);
+        save_batch_finish(batch);
+        return;
+    }
+    close(argfile_fd);
+    g_string_free(argfile, TRUE);
+
+    gchar *status_text = g_strdup_printf("Gravando metadados de %u PDF(s)...", writes);
+    gtk_label_set_text(GTK_LABEL(status_label), status_text);
+    SAFE_FREE(status_text);
+
+    gchar *argv[] = { (gchar *)"exiftool", (gchar *)"-@", batch->argfile_path, NULL };
+    GPid pid;
+    gint stdout_fd_local = -1, stderr_fd_local = -1;
+    GError *spawn_error = NULL;
+
+    if (!g_spawn_async_with_pipes(NULL, argv, NULL,
+                                  G_SPAWN_SEARCH_PATH | G_SPAWN_DO_NOT_REAP_CHILD,
+                                  NULL, NULL, &pid, NULL,
+                                  &stdout_fd_local, &stderr_fd_local, &spawn_error)) {
+        g_warning("Failed to spawn batched exiftool metadata write: %s",
+                  spawn_error ? spawn_error->message : "N/A");
+        if (spawn_error) g_error_free(spawn_error);
+        g_unlink(batch->argfile_path);
+        save_batch_finish(batch);
+        return;
+    }
+
+    batch->journal_metadata_op = save_journal_intent("metadata-batch", batch->argfile_path,
+                                                     batch->professor);
+    g_print("Batched metadata write started for %u file(s) (PID: %d).\n", writes, pid);
+    trace_count(TRACE_COUNT_PROCESSES_SPAWNED, 1);
+    trace_log(TRACE_METADATA_WRITE, "argfile %s, %u write section(s)", batch->argfile_path, writes);
+    exiftool_spawn_watch_new(pid, stdout_fd_local, stderr_fd_local, save_batch_metadata_done, batch);
+}
+
+/**
+ * @brief Main-thread accounting for one finished save job.
+ *
+ * Updates the progress bar and, once every job of the batch has reported in,
+ * kicks off the batched metadata write (which in turn fires the batch
+ * completion callback). Jobs stay owned by the batch until then.
+ */
+static gboolean save_job_progress_idle(gpointer data) {
+    SaveJob *job = (SaveJob *)data;
+    SaveBatch *batch = job->batch;
+
+    batch->completed++;
+    if (!job->success) {
+        batch->failed++;
+        g_warning("Failed to save PDF entry: %s", job->src_path ? job->src_path : "N/A");
+    }
+
+    gdouble fraction_done = (gdouble)batch->completed / batch->total;
+    gdouble overall_fraction = batch->progress_base + fraction_done * batch->progress_span;
+    gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(progress_bar), overall_fraction);
+    gchar *progress_percent_text = g_strdup_printf("%d%%", (gint)(overall_fraction * 100));
+    gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progress_bar), progress_percent_text);
+    SAFE_FREE(progress_percent_text);
+
+    gchar *progress_text = g_strdup_printf("Salvando PDF %d de %d: %s",
+                                           batch->completed, batch->total, job->title);
+    gtk_label_set_text(GTK_LABEL(status_label), progress_text);
+    SAFE_FREE(progress_text);
+
+    if (batch->completed == batch->total) {
+        save_batch_write_metadata(batch);
+    }
+
+    return G_SOURCE_REMOVE;
+}
+
+/**
+ * @brief Dispatches every GUI entry to the save worker pool.
+ *
+ * Jobs are prepared serially on the main thread (keeping counter assignment
+ * deterministic), then executed in parallel. Returns the number of jobs
+ * queued, 0 if nothing was valid to save, or -1 if a batch is already
+ * running. on_complete fires on the main thread after the last job and the
+ * batched metadata write have finished.
+ */
+gint save_all_entries_async(const gchar *professor_name, gdouble progress_base, gdouble progress_span,
+                            SaveBatchCallback on_complete) {
+    if (active_save_batch) {
+        g_warning("A save batch is already running; ignoring new request.");
+        return -1;
+    }
+    if (!save_pool_get()) {
+        return -1;
+    }
+
+    SaveBatch *batch = g_new0(SaveBatch, 1);
+    batch->professor = g_strdup(professor_name);
+    batch->progress_base = progress_base;
+    batch->progress_span = progress_span;
+    batch->on_complete = on_complete;
+
+    batch->jobs = g_ptr_array_new_with_free_func((GDestroyNotify)save_job_free);
+    for (gint i = 0; i < global_num_categories; i++) {
+        g_print("Processing category: %s\n", global_categories[i]);
+        for (guint k = 0; k < global_sections[i].entries->len; k++) {
+            PdfEntry *entry = g_ptr_array_index(global_sections[i].entries, k);
+            SaveJob *job = prepare_save_job(entry, professor_name, i, batch);
+            if (job) {
+                g_ptr_array_add(batch->jobs, job);
+            } else {
+                g_warning("Skipped PDF entry during save: %s", entry->file_path ? entry->file_path : "N/A");
+            }
+        }
+    }
+
+    batch->total = (gint)batch->jobs->len;
+    if (batch->total == 0) {
+        g_ptr_array_free(batch->jobs, TRUE);
+        SAFE_FREE(batch->professor);
+        g_free(batch);
+        return 0;
+    }
+
+    active_save_batch = batch;
+    save_journal_open(professor_name, batch->total);
+    g_print("Dispatching %d save jobs to the worker pool...\n", batch->total);
+
+    for (guint j = 0; j < batch->jobs->len; j++) {
+        GError *push_error = NULL;
+        if (!g_thread_pool_push(save_pool, g_ptr_array_index(batch->jobs, j), &push_error)) {
+            // Push only fails on thread creation errors; run the job inline
+            // so the batch accounting still closes.
+            g_warning("Thread pool push failed (%s); executing save job inline.",
+                      push_error ? push_error->message : "N/A");
+            if (push_error) g_error_free(push_error);
+            execute_save_job(g_ptr_array_index(batch->jobs, j), NULL);
+        }
+    }
+
+    return batch->total;
+}
+
+/**
+ * @brief Callback when report generation finishes. Displays status, opens PDF.
+ */
+void on_report_generation_finished(GPid pid, gint status, gpointer user_data) {
+    gchar *professor_name = (gchar *)user_data;
+    g_print("Report generation process (PID: %d) finished with status: %d\n", pid, status);
+
+    g_spawn_close_pid(pid);
+
+    if (WIFEXITED(status) && WEXITSTATUS(status) == 0) {
+        GtkWidget *dialog = gtk_message_dialog_new(NULL,
+                                                   GTK_DIALOG_MODAL,
+                                                   GTK_MESSAGE_INFO,
+                                                   GTK_BUTTONS_OK,
+                                                   "Relatório gerado com sucesso!");
+        gtk_dialog_run(GTK_DIALOG(dialog));
+        gtk_widget_destroy(dialog);
+
+        gchar *sanitized_professor_name = sanitize_filename(professor_name);
+        gchar *pdf_filename = g_strdup_printf("final/%s_relatorio_profissional.pdf", sanitized_professor_name);
+        GError *spawn_error = NULL;
+
+        if (g_file_test(pdf_filename, G_FILE_TEST_EXISTS)) {
+            gchar *xdg_open_command = g_strdup_printf("xdg-open \"%s\"", pdf_filename);
+            g_print("Attempting to open PDF with command: %s\n", xdg_open_command);
+
+            if (!g_spawn_command_line_async(xdg_open_command, &spawn_error)) {
+                g_warning("Failed to launch PDF viewer via xdg-open: %s", spawn_error ? spawn_error->message : "N/A");
+                if (spawn_error) g_error_free(spawn_error);
+            } else {
+                g_print("PDF viewer launched successfully (via xdg-open).\n");
+            }
+            SAFE_FREE(xdg_open_command);
+            if (preview_report_btn) {
+                gtk_widget_show(preview_report_btn);
+            }
+        } else {
+            g_warning("Generated PDF not found at path: %s", pdf_filename);
+            if (preview_report_btn) {
+                gtk_widget_hide(preview_report_btn);
+            }
+        }
+        SAFE_FREE(pdf_filename);
+        SAFE_FREE(sanitized_professor_name);
+
+        gtk_label_set_text(GTK_LABEL(status_label), "Pronto.");
+        gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(progress_bar), 1.0);
+        gchar *progress_text_100 = g_strdup_printf("%d%%", 100);
+        gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progress_bar), progress_text_100);
+        SAFE_FREE(progress_text_100);
+
+    } else {
+        GtkWidget *dialog = gtk_message_dialog_new(NULL,
+                                                   GTK_DIALOG_MODAL,
+                                                   GTK_MESSAGE_ERROR,
+                                                   GTK_BUTTONS_OK,
+                                                   "Falha ao gerar o relatório. Verifique o log do script no terminal que foi aberto.");
+        gtk_dialog_run(GTK_DIALOG(dialog));
+        gtk_widget_destroy(dialog);
+        g_warning("Backend script failed with exit status: %d", status);
+        gtk_label_set_text(GTK_LABEL(status_label), "Erro na geração do relatório.");
+        gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(progress_bar), 0.0);
+        gchar *progress_text_error = g_strdup_printf("Erro!");
+        gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progress_bar), progress_text_error);
+        SAFE_FREE(progress_text_error);
+        if (preview_report_btn) {
+            gtk_widget_hide(preview_report_btn);
+        }
+    }
+    SAFE_FREE(professor_name);
+}
+
+/**
+ * @brief Exports the page-count manifest consumed by the backend script.
+ *
+ * One "<category>/<basename>\t<pages>" line per entry with a known page
+ * count, written to pdf_temp/<professor>/.page_counts. The backend uses it
+ * to weight its PROGRESS lines by pages instead of file count; when a file
+ * is missing from the manifest it falls back to per-file weighting, so a
+ * partial manifest is never wrong, just less precise.
+ */
+static void write_page_count_manifest(const gchar *professor) {
+    GString *manifest = g_string_new(NULL);
+
+    for (gint i = 0; i < global_num_categories; i++) {
+        if (!global_sections || !global_sections[i].entries) continue;
+        for (guint j = 0; j < global_sections[i].entries->len; j++) {
+            PdfEntry *entry = g_ptr_array_index(global_sections[i].entries, j);
+            if (!entry->file_path || entry->page_count <= 0) continue;
+            gchar *file_basename = g_path_get_basename(entry->file_path);
+            g_string_append_printf(manifest, "%s/%s\t%d\n",
+                                   global_categories[i], file_basename, entry->page_count);
+            SAFE_FREE(file_basename);
+        }
+    }
+
+    if (manifest->len > 0) {
+        gchar *temp_dir = g_strdup_printf("./pdf_temp/%s", professor);
+        if (g_mkdir_with_parents(temp_dir, 0755) == 0 || errno == EEXIST) {
+            gchar *manifest_path = g_strdup_printf("%s/.page_counts", temp_dir);
+            GError *write_error = NULL;
+            if (!g_file_set_contents(manifest_path, manifest->str, -1, &write_error)) {
+                g_warning("Could not write page-count manifest '%s': %s",
+                          manifest_path, write_error ? write_error->message : "N/A");
+                if (write_error) g_error_free(write_error);
+            }
+            SAFE_FREE(manifest_path);
+        }
+        SAFE_FREE(temp_dir);
+    }
+
+    g_string_free(manifest, TRUE);
+}
+
+/**
+ * @brief Spawns the backend LaTeX script for a professor in a terminal.
+ */
+void launch_report_backend(const gchar *professor) {
+    gchar *terminal_path = g_find_program_in_path("gnome-terminal");
+    if (!terminal_path) {
+        GtkWidget *dialog = gtk_message_dialog_new(NULL,
+                                                   GTK_DIALOG_MODAL,
+                                                   GTK_MESSAGE_ERROR,
+                                                   GTK_BUTTONS_OK,
+                                                   "Erro: O programa 'gnome-terminal' não foi encontrado no seu PATH.\n"
+                                                   "Por favor, certifique-se de que está instalado e acessível.");
+        gtk_dialog_run(GTK_DIALOG(dialog));
+        gtk_widget_destroy(dialog);
+        gtk_label_set_text(GTK_LABEL(status_label), "Erro: Terminal não encontrado.");
+        gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(progress_bar), 0.0);
+        gchar *progress_text_error = g_strdup_printf("Erro!");
+        gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progress_bar), progress_text_error);
+        SAFE_FREE(progress_text_error);
+        if (preview_report_btn) {
+            gtk_widget_hide(preview_report_btn);
+        }
+        return;
+    }
+
+    write_page_count_manifest(professor);
+
+    gchar *script_path = g_strdup(BACKEND_SCRIPT_PATH);
+    gchar *professor_arg_quoted = g_shell_quote(professor);
+
+    gchar *command_in_terminal = g_strdup_printf("%s %s; echo \"\"; echo \"Pressione Enter para fechar esta janela...\"; read -n 1",
+                                                  script_path, professor_arg_quoted);
+
+    gchar *argv_terminal[] = {
+        terminal_path,
+        g_strdup("--wait"),
+        g_strdup("--"),
+        g_strdup("bash"),
+        g_strdup("-c"),
+        command_in_terminal,
+        NULL
+    };
+
+    GPid child_pid;
+    GError *spawn_error = NULL;
+
+    gtk_label_set_text(GTK_LABEL(status_label), "Abrindo terminal para compilar relatório LaTeX...");
+    gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(progress_bar), 0.9);
+    gchar *progress_text_90 = g_strdup_printf("%d%%", 90);
+    gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progress_bar), progress_text_90);
+    SAFE_FREE(progress_text_90);
+    g_main_context_iteration(NULL, FALSE);
+
+    if (!g_spawn_async(NULL,
+                       argv_terminal,
+                       NULL,
+                       G_SPAWN_DO_NOT_REAP_CHILD,
+                       NULL,
+                       NULL,
+                       &child_pid,
+                       &spawn_error)) {
+        GtkWidget *dialog = gtk_message_dialog_new(NULL,
+                                                   GTK_DIALOG_MODAL,
+                                                   GTK_MESSAGE_ERROR,
+                                                   GTK_BUTTONS_OK,
+                                                   "Falha ao iniciar o terminal para geração de relatório: %s", spawn_error ? spawn_error->message : "N/A");
+        gtk_dialog_run(GTK_DIALOG(dialog));
+        gtk_widget_destroy(dialog);
+        if (spawn_error) g_error_free(spawn_error);
+        gtk_label_set_text(GTK_LABEL(status_label), "Erro ao iniciar geração.");
+        gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(progress_bar), 0.0);
+        gchar *progress_text_error_again = g_strdup_printf("Erro!");
+        gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progress_bar), progress_text_error_again);
+        SAFE_FREE(progress_text_error_again);
+        if (preview_report_btn) {
+            gtk_widget_hide(preview_report_btn);
+        }
+    } else {
+        g_print("Terminal spawned successfully with PID: %d\n", child_pid);
+        trace_count(TRACE_COUNT_PROCESSES_SPAWNED, 1);
+        trace_log(TRACE_REPORT, "backend launched for %s (PID: %d)", professor, child_pid);
+        g_child_watch_add(child_pid, on_report_generation_finished, g_strdup(professor));
+    }
+
+    SAFE_FREE(terminal_path);
+    SAFE_FREE(argv_terminal[1]);
+    SAFE_FREE(argv_terminal[2]);
+    SAFE_FREE(argv_terminal[3]);
+    SAFE_FREE(argv_terminal[4]);
+    SAFE_FREE(argv_terminal[5]);
+    SAFE_FREE(script_path);
+    SAFE_FREE(professor_arg_quoted);
+}
+
+/**
+ * @brief Save-batch continuation for 'Gerar Relatório Profissional'.
+ */
+static void generate_report_save_done(SaveBatch *batch) {
+    g_print("Save batch finished: %d of %d entries saved (%d failed).\n",
+            batch->total - batch->failed, batch->total, batch->failed);
+    launch_report_backend(batch->professor);
+}
+
+// =============================================================================
+// PREFLIGHT VALIDATION
+// =============================================================================
+
+#define PREFLIGHT_MAX_LISTED 12
+
+/**
+ * @brief Appends one numbered problem line, listing at most
+ * PREFLIGHT_MAX_LISTED in full (the rest are only counted).
+ */
+static void preflight_add_problem(GString *problems, gint *problem_count, const gchar *format, ...) {
+    (*problem_count)++;
+    if (*problem_count > PREFLIGHT_MAX_LISTED) return;
 
-    if (source_file) g_object_unref(source_file);
-    if (destination_file) g_object_unref(destination_file);
+    va_list args;
+    va_start(args, format);
+    gchar *message = g_strdup_vprintf(format, args);
+    va_end(args);
 
-    gchar *exiftool_command_line = g_strdup_printf("exiftool -charset utf8 -Title=\"%s\" -Year=\"%s\" -Category=\"%s\" -overwrite_original_in_place \"%s\"",
-                                              title_raw, year, current_category_text, dest_file_path);
-    g_print("    Executing exiftool command to write metadata: %s\n", exiftool_command_line);
+    g_string_append_printf(problems, "%d. %s\n", *problem_count, message);
+    SAFE_FREE(message);
+}
 
-    gchar **exiftool_argv = NULL;
-    gint exiftool_argc = 0;
-    GError *exiftool_error = NULL;
-    gboolean exiftool_success = g_shell_parse_argv(exiftool_command_line, &exiftool_argc, &exiftool_argv, &exiftool_error);
-    if (!exiftool_success) {
-        g_warning("Failed to parse exiftool write command line: %s (%s)", exiftool_command_line, exiftool_error ? exiftool_error->message : "N/A");
-        if (exiftool_error) g_error_free(exiftool_error);
-        SAFE_FREE(exiftool_command_line);
-        SAFE_FREE(sanitized_category_for_filename);
-        SAFE_FREE(final_filename_no_ext);
-        SAFE_FREE(dest_file_name);
-        SAFE_FREE(dest_file_path);
-        SAFE_FREE(dest_category_dir);
-        SAFE_FREE(professor_base_dir);
-        return FALSE;
+/**
+ * @brief Fail-fast validation of everything the save/report pipeline is
+ * about to pay for: tool and backend availability, empty title/year/
+ * category fields, missing source files, and duplicate counters within a
+ * category (which silently overwrite each other's %02d_-prefixed
+ * destination). Pure in-memory checks plus a few stat calls -- runs in
+ * milliseconds before any copy or spawn.
+ *
+ * Returns NULL when everything checks out, otherwise a problem list for
+ * the caller to show (and free).
+ */
+static gchar* preflight_validate(void) {
+    GString *problems = g_string_new("");
+    gint problem_count = 0;
+
+    gchar *exiftool_path = g_find_program_in_path("exiftool");
+    if (!exiftool_path) {
+        preflight_add_problem(problems, &problem_count,
+                              "O programa 'exiftool' não foi encontrado no PATH.");
     }
+    SAFE_FREE(exiftool_path);
 
-    gchar *exiftool_stdout = NULL;
-    gchar *exiftool_stderr = NULL;
-    gint exiftool_exit_status = 0;
-
-    exiftool_success = g_spawn_sync(
-        NULL,
-        exiftool_argv,
-        NULL,
-        G_SPAWN_SEARCH_PATH,
-        NULL,
-        NULL,
-        &exiftool_stdout,
-        &exiftool_stderr,
-        &exiftool_exit_status,
-        &exiftool_error
-    );
-
-    if (exiftool_argv) g_strfreev(exiftool_argv);
-    SAFE_FREE(exiftool_command_line);
-    SAFE_FREE(exiftool_stdout);
-    SAFE_FREE(exiftool_stderr);
-
-    if (!exiftool_success || exiftool_exit_status != 0) {
-        g_warning("Failed to update metadata for %s. Exiftool command failed with exit code: %d. Error: %s",
-                  dest_file_path, exiftool_exit_status, exiftool_error ? exiftool_error->message : "N/A");
-        if (exiftool_error) g_error_free(exiftool_error);
-    } else {
-        g_print("    Metadata successfully written to %s.\n", dest_file_path);
+    gchar *bash_path = g_find_program_in_path("bash");
+    if (!bash_path) {
+        preflight_add_problem(problems, &problem_count,
+                              "O interpretador 'bash' não foi encontrado no PATH.");
     }
+    SAFE_FREE(bash_path);
 
-    gboolean filename_changed = (entry->original_filename_no_ext == NULL || g_strcmp0(final_filename_no_ext, entry->original_filename_no_ext) != 0);
+    if (!g_file_test(BACKEND_SCRIPT_PATH, G_FILE_TEST_EXISTS)) {
+        preflight_add_problem(problems, &problem_count,
+                              "Script de geração '%s' não encontrado.", BACKEND_SCRIPT_PATH);
+    }
 
-    if (filename_changed && entry->file_path != NULL && g_file_test(entry->file_path, G_FILE_TEST_EXISTS)) {
-        gchar *old_files_dir = g_strdup_printf("%s/old_files", dest_category_dir);
-        g_print("    Attempting to ensure old_files directory exists: %s\n", old_files_dir);
+    for (gint i = 0; i < global_num_categories; i++) {
+        GPtrArray *entries = global_sections[i].entries;
+        if (!entries) continue;
 
-        if (!is_valid_path(old_files_dir)) {
-            g_warning("Invalid old_files directory path: %s", old_files_dir);
-            SAFE_FREE(old_files_dir);
-        } else {
-            if (!g_mkdir_with_parents(old_files_dir, 0755)) {
-                if (errno != EEXIST) {
-                    g_warning("Failed to create old_files directory: %s (%s)", old_files_dir, g_strerror(errno));
-                }
-            } else {
-                g_print("    Old_files directory exists (or was created): %s\n", old_files_dir);
-            }
+        GHashTable *counters_seen = g_hash_table_new(g_direct_hash, g_direct_equal);
 
-            gchar *original_basename = g_path_get_basename(entry->file_path);
-            gchar *old_file_dest_path = g_strdup_printf("%s/%s", old_files_dir, original_basename);
-            g_print("    Moving original file from %s to %s\n", entry->file_path, old_file_dest_path);
+        for (guint k = 0; k < entries->len; k++) {
+            PdfEntry *entry = g_ptr_array_index(entries, k);
+            if (!entry) continue;
 
-            if (!is_valid_path(old_file_dest_path)) {
-                g_warning("Invalid old file destination path: %s", old_file_dest_path);
-                SAFE_FREE(original_basename);
-                SAFE_FREE(old_file_dest_path);
-                SAFE_FREE(old_files_dir);
-            } else {
-                GError *move_error = NULL;
-                GFile *original_gfile_to_move = g_file_new_for_path(entry->file_path);
-                GFile *old_dest_gfile = g_file_new_for_path(old_file_dest_path);
+            const gchar *title = pdf_entry_get_title(entry);
+            const gchar *year = pdf_entry_get_year(entry);
+            const gchar *category_text = pdf_entry_get_category(entry);
+            gboolean has_file = entry->file_path && *entry->file_path != '\0';
 
-                if (g_file_query_exists(original_gfile_to_move, NULL)) {
-                    if (!g_file_move(original_gfile_to_move, old_dest_gfile, G_FILE_COPY_OVERWRITE, NULL, NULL, NULL, &move_error)) {
-                        g_warning("Failed to move original file from %s to %s: %s", entry->file_path, old_file_dest_path, move_error ? move_error->message : "N/A");
-                        if (move_error) g_error_free(move_error);
-                    } else {
-                        g_print("    Original file successfully moved to: %s\n", old_file_dest_path);
-                    }
+            if (!has_file) {
+                preflight_add_problem(problems, &problem_count,
+                                      "Categoria '%s', entrada %u: nenhum arquivo PDF selecionado.",
+                                      global_categories[i], k + 1);
+                continue;
+            }
+            if (!g_file_test(entry->file_path, G_FILE_TEST_EXISTS)) {
+                preflight_add_problem(problems, &problem_count,
+                                      "Categoria '%s': arquivo não existe: %s",
+                                      global_categories[i], entry->file_path);
+            }
+            if (g_strcmp0(title, "") == 0) {
+                preflight_add_problem(problems, &problem_count,
+                                      "Categoria '%s' (%s): título vazio.",
+                                      global_categories[i], entry->file_path);
+            }
+            if (g_strcmp0(year, "") == 0) {
+                preflight_add_problem(problems, &problem_count,
+                                      "Categoria '%s' (%s): ano vazio.",
+                                      global_categories[i], entry->file_path);
+            }
+            if (g_strcmp0(category_text, "") == 0) {
+                preflight_add_problem(problems, &problem_count,
+                                      "Categoria '%s' (%s): campo de categoria vazio.",
+                                      global_categories[i], entry->file_path);
+            }
+
+            // Mirror prepare_save_job's counter choice: manual counter
+            // text wins, then the filename-detected one. Entries with
+            // neither get a fresh unique counter assigned during save and
+            // cannot collide, so they are not checked.
+            gint effective_counter = 0;
+            const gchar *counter_text = pdf_entry_get_counter(entry);
+            if (counter_text && *counter_text != '\0' && atoi(counter_text) > 0) {
+                effective_counter = atoi(counter_text);
+            } else if (entry->has_original_counter && entry->original_detected_counter > 0) {
+                effective_counter = entry->original_detected_counter;
+            }
+            if (effective_counter > 0) {
+                gpointer counter_key = GINT_TO_POINTER(effective_counter);
+                if (g_hash_table_contains(counters_seen, counter_key)) {
+                    preflight_add_problem(problems, &problem_count,
+                                          "Categoria '%s': contador %02d duplicado (os arquivos salvos se sobrescreveriam).",
+                                          global_categories[i], effective_counter);
                 } else {
-                    g_warning("Original file %s does not exist (perhaps already moved or deleted), skipping move to old_files.", entry->file_path);
+                    g_hash_table_add(counters_seen, counter_key);
                 }
-
-                if (original_gfile_to_move) g_object_unref(original_gfile_to_move);
-                if (old_dest_gfile) g_object_unref(old_dest_gfile);
-                SAFE_FREE(original_basename);
-                SAFE_FREE(old_file_dest_path);
-                SAFE_FREE(old_files_dir);
             }
         }
-    } else {
-        g_print("    Filename unchanged or original file not found, skipping move to old_files for %s.\n", entry->file_path ? entry->file_path : "N/A");
+        g_hash_table_destroy(counters_seen);
     }
 
-    SAFE_FREE(sanitized_category_for_filename);
-    SAFE_FREE(final_filename_no_ext);
-    SAFE_FREE(dest_file_name);
-    SAFE_FREE(dest_file_path);
-    SAFE_FREE(dest_category_dir);
-    SAFE_FREE(professor_base_dir);
-
-    return TRUE;
+    if (problem_count == 0) {
+        g_string_free(problems, TRUE);
+        return NULL;
+    }
+    if (problem_count > PREFLIGHT_MAX_LISTED) {
+        g_string_append_printf(problems, "... e mais %d problema(s). Veja o terminal para a lista completa.\n",
+                               problem_count - PREFLIGHT_MAX_LISTED);
+    }
+    g_print("Preflight validation found %d problem(s):\n%s", problem_count, problems->str);
+    return g_string_free(problems, FALSE);
 }
 
 /**
- * @brief Callback when report generation finishes. Displays status, opens PDF.
+ * @brief Runs preflight and, on failure, shows every problem at once and
+ * refuses to start. TRUE when the pipeline may proceed.
  */
-void on_report_generation_finished(GPid pid, gint status, gpointer user_data) {
-    gchar *professor_name = (gchar *)user_data;
-    g_print("Report generation process (PID: %d) finished with status: %d\n", pid, status);
-
-    g_spawn_close_pid(pid);
-
-    if (WIFEXITED(status) && WEXITSTATUS(status) == 0) {
-        GtkWidget *dialog = gtk_message_dialog_new(NULL,
-                                                   GTK_DIALOG_MODAL,
-                                                   GTK_MESSAGE_INFO,
-                                                   GTK_BUTTONS_OK,
-                                                   "Relatório gerado com sucesso!");
-        gtk_dialog_run(GTK_DIALOG(dialog));
-        gtk_widget_destroy(dialog);
-
-        gchar *sanitized_professor_name = sanitize_filename(professor_name);
-        gchar *pdf_filename = g_strdup_printf("final/%s_relatorio_profissional.pdf", sanitized_professor_name);
-        GError *spawn_error = NULL;
-
-        if (g_file_test(pdf_filename, G_FILE_TEST_EXISTS)) {
-            gchar *xdg_open_command = g_strdup_printf("xdg-open \"%s\"", pdf_filename);
-            g_print("Attempting to open PDF with command: %s\n", xdg_open_command);
-
-            if (!g_spawn_command_line_async(xdg_open_command, &spawn_error)) {
-                g_warning("Failed to launch PDF viewer via xdg-open: %s", spawn_error ? spawn_error->message : "N/A");
-                if (spawn_error) g_error_free(spawn_error);
-            } else {
-                g_print("PDF viewer launched successfully (via xdg-open).\n");
-            }
-            SAFE_FREE(xdg_open_command);
-            if (preview_report_btn) {
-                gtk_widget_show(preview_report_btn);
-            }
-        } else {
-            g_warning("Generated PDF not found at path: %s", pdf_filename);
-            if (preview_report_btn) {
-                gtk_widget_hide(preview_report_btn);
-            }
-        }
-        SAFE_FREE(pdf_filename);
-        SAFE_FREE(sanitized_professor_name);
+static gboolean preflight_check_or_abort(const gchar *action_label) {
+    gchar *problem_list = preflight_validate();
+    if (!problem_list) return TRUE;
 
-        gtk_label_set_text(GTK_LABEL(status_label), "Pronto.");
-        gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(progress_bar), 1.0);
-        gchar *progress_text_100 = g_strdup_printf("%d%%", 100);
-        gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progress_bar), progress_text_100);
-        SAFE_FREE(progress_text_100);
+    GtkWidget *dialog = gtk_message_dialog_new(NULL,
+                                               GTK_DIALOG_MODAL,
+                                               GTK_MESSAGE_ERROR,
+                                               GTK_BUTTONS_OK,
+                                               "%s não foi iniciado. Corrija os problemas abaixo:\n\n%s",
+                                               action_label, problem_list);
+    gtk_dialog_run(GTK_DIALOG(dialog));
+    gtk_widget_destroy(dialog);
+    SAFE_FREE(problem_list);
 
-    } else {
-        GtkWidget *dialog = gtk_message_dialog_new(NULL,
-                                                   GTK_DIALOG_MODAL,
-                                                   GTK_MESSAGE_ERROR,
-                                                   GTK_BUTTONS_OK,
-                                                   "Falha ao gerar o relatório. Verifique o log do script no terminal que foi aberto.");
-        gtk_dialog_run(GTK_DIALOG(dialog));
-        gtk_widget_destroy(dialog);
-        g_warning("Backend script failed with exit status: %d", status);
-        gtk_label_set_text(GTK_LABEL(status_label), "Erro na geração do relatório.");
-        gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(progress_bar), 0.0);
-        gchar *progress_text_error = g_strdup_printf("Erro!");
-        gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progress_bar), progress_text_error);
-        SAFE_FREE(progress_text_error);
-        if (preview_report_btn) {
-            gtk_widget_hide(preview_report_btn);
-        }
-    }
-    SAFE_FREE(professor_name);
+    gtk_label_set_text(GTK_LABEL(status_label), "Cancelado: problemas encontrados na validação.");
+    gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(progress_bar), 0.0);
+    gchar *progress_text_0 = g_strdup_printf("%d%%", 0);
+    gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progress_bar), progress_text_0);
+    SAFE_FREE(progress_text_0);
+    g_main_context_iteration(NULL, FALSE);
+    return FALSE;
 }
 
 /**
@@ -1757,6 +5027,11 @@ void generate_report(GtkWidget *widget, gpointer data) {
 
     g_print("Generating report for professor: %s\n", professor);
 
+    // Fail fast: surface every problem now instead of minutes into the run.
+    if (!preflight_check_or_abort("O relatório")) {
+        return;
+    }
+
     if (preview_report_btn) {
         gtk_widget_hide(preview_report_btn);
     }
@@ -1818,124 +5093,69 @@ void generate_report(GtkWidget *widget, gpointer data) {
     g_print("  Professor directory exists (or was created): %s\n", professor_folder_path);
     SAFE_FREE(professor_folder_path);
 
-    gint total_pdfs_to_process = 0;
-    for (gint i = 0; i < global_num_categories; i++) {
-        total_pdfs_to_process += g_list_length(global_sections[i].entries);
-    }
-    g_print("Total PDFs to process: %d\n", total_pdfs_to_process);
-
-    gint processed_pdfs_count = 0;
-
-    for (gint i = 0; i < global_num_categories; i++) {
-        g_print("Processing category: %s\n", global_categories[i]);
-        GList *l;
-        for (l = global_sections[i].entries; l != NULL; l = g_list_next(l)) {
-            PdfEntry *entry = (PdfEntry *)l->data;
-            if (save_single_pdf_entry(entry, professor, i)) {
-                processed_pdfs_count++;
-                gdouble fraction_of_processing = (gdouble)processed_pdfs_count / total_pdfs_to_process;
-                gdouble overall_fraction = 0.2 + (fraction_of_processing * 0.7);
-                gchar *progress_text = g_strdup_printf("Processando PDF %d de %d: %s",
-                                                       processed_pdfs_count, total_pdfs_to_process, gtk_entry_get_text(GTK_ENTRY(entry->title_entry)));
-                gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(progress_bar), overall_fraction);
-                gchar *progress_percent_text = g_strdup_printf("%d%%", (gint)(overall_fraction * 100));
-                gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progress_bar), progress_percent_text);
-                SAFE_FREE(progress_percent_text);
-                gtk_label_set_text(GTK_LABEL(status_label), progress_text);
-                SAFE_FREE(progress_text);
-                g_main_context_iteration(NULL, FALSE);
-            } else {
-                g_warning("Failed to save PDF entry: %s", entry->file_path ? entry->file_path : "N/A");
-            }
-        }
-    }
-
     SAFE_FREE(professor_base_dir);
 
-    gchar *terminal_path = g_find_program_in_path("gnome-terminal");
-    if (!terminal_path) {
-        GtkWidget *dialog = gtk_message_dialog_new(NULL,
-                                                   GTK_DIALOG_MODAL,
-                                                   GTK_MESSAGE_ERROR,
-                                                   GTK_BUTTONS_OK,
-                                                   "Erro: O programa 'gnome-terminal' não foi encontrado no seu PATH.\n"
-                                                   "Por favor, certifique-se de que está instalado e acessível.");
-        gtk_dialog_run(GTK_DIALOG(dialog));
-        gtk_widget_destroy(dialog);
-        gtk_label_set_text(GTK_LABEL(status_label), "Erro: Terminal não encontrado.");
-        gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(progress_bar), 0.0);
-        gchar *progress_text_error = g_strdup_printf("Erro!");
-        gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progress_bar), progress_text_error);
-        SAFE_FREE(progress_text_error);
-        if (preview_report_btn) {
-            gtk_widget_hide(preview_report_btn);
-        }
+    // Copy + metadata writes run on the save worker pool; the backend script
+    // is launched from the batch completion callback once every job is done.
+    gint dispatched = save_all_entries_async(professor, 0.2, 0.7, generate_report_save_done);
+
+    if (dispatched < 0) {
+        gtk_label_set_text(GTK_LABEL(status_label), "Salvamento já em andamento. Aguarde a conclusão.");
         return;
     }
 
-    gchar *script_path = g_strdup("./generate_pdf_professor_v2.0.1-R22.sh");
-    gchar *professor_arg_quoted = g_shell_quote(professor);
-
-    gchar *command_in_terminal = g_strdup_printf("%s %s; echo \"\"; echo \"Pressione Enter para fechar esta janela...\"; read -n 1",
-                                                  script_path, professor_arg_quoted);
-
-    gchar *argv_terminal[] = {
-        terminal_path,
-        g_strdup("--wait"),
-        g_strdup("--"),
-        g_strdup("bash"),
-        g_strdup("-c"),
-        command_in_terminal,
-        NULL
-    };
-
-    GPid child_pid;
-    GError *spawn_error = NULL;
+    if (dispatched == 0) {
+        g_print("No valid PDF entries to save; launching backend directly.\n");
+        launch_report_backend(professor);
+    } else {
+        g_print("Total PDFs dispatched for processing: %d\n", dispatched);
+    }
+}
 
-    gtk_label_set_text(GTK_LABEL(status_label), "Abrindo terminal para compilar relatório LaTeX...");
-    gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(progress_bar), 0.9);
-    gchar *progress_text_90 = g_strdup_printf("%d%%", 90);
-    gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progress_bar), progress_text_90);
-    SAFE_FREE(progress_text_90);
-    g_main_context_iteration(NULL, FALSE);
+/**
+ * @brief Save-batch continuation for 'Salvar Alterações'.
+ */
+static void save_all_entries_done(SaveBatch *batch) {
+    GtkWidget *dialog;
+    if (batch->failed == 0) {
+        dialog = gtk_message_dialog_new(NULL,
+                                        GTK_DIALOG_MODAL,
+                                        GTK_MESSAGE_INFO,
+                                        GTK_BUTTONS_OK,
+                                        "Alterações salvas com sucesso!");
+    } else {
+        dialog = gtk_message_dialog_new(NULL,
+                                        GTK_DIALOG_MODAL,
+                                        GTK_MESSAGE_WARNING,
+                                        GTK_BUTTONS_OK,
+                                        "Alterações salvas, mas %d de %d PDFs falharam. Verifique o log no terminal.",
+                                        batch->failed, batch->total);
+    }
+    gtk_dialog_run(GTK_DIALOG(dialog));
+    gtk_widget_destroy(dialog);
 
-    if (!g_spawn_async(NULL,
-                       argv_terminal,
-                       NULL,
-                       G_SPAWN_DO_NOT_REAP_CHILD,
-                       NULL,
-                       NULL,
-                       &child_pid,
-                       &spawn_error)) {
-        GtkWidget *dialog = gtk_message_dialog_new(NULL,
-                                                   GTK_DIALOG_MODAL,
-                                                   GTK_MESSAGE_ERROR,
-                                                   GTK_BUTTONS_OK,
-                                                   "Falha ao iniciar o terminal para geração de relatório: %s", spawn_error ? spawn_error->message : "N/A");
-        gtk_dialog_run(GTK_DIALOG(dialog));
-        gtk_widget_destroy(dialog);
-        if (spawn_error) g_error_free(spawn_error);
-        gtk_label_set_text(GTK_LABEL(status_label), "Erro ao iniciar geração.");
-        gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(progress_bar), 0.0);
-        gchar *progress_text_error_again = g_strdup_printf("Erro!");
-        gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progress_bar), progress_text_error_again);
-        SAFE_FREE(progress_text_error_again);
+    gchar *sanitized_professor_name = sanitize_filename(batch->professor);
+    gchar *pdf_filename = g_strdup_printf("final/%s_relatorio_profissional.pdf", sanitized_professor_name);
+    if (g_file_test(pdf_filename, G_FILE_TEST_EXISTS)) {
         if (preview_report_btn) {
-            gtk_widget_hide(preview_report_btn);
+            gtk_widget_show(preview_report_btn);
         }
     } else {
-        g_print("Terminal spawned successfully with PID: %d\n", child_pid);
-        g_child_watch_add(child_pid, on_report_generation_finished, g_strdup(professor));
+        if (preview_report_btn) {
+            gtk_widget_hide(preview_report_btn);
+        }
     }
+    SAFE_FREE(pdf_filename);
+    SAFE_FREE(sanitized_professor_name);
 
-    SAFE_FREE(terminal_path);
-    SAFE_FREE(argv_terminal[1]);
-    SAFE_FREE(argv_terminal[2]);
-    SAFE_FREE(argv_terminal[3]);
-    SAFE_FREE(argv_terminal[4]);
-    SAFE_FREE(argv_terminal[5]);
-    SAFE_FREE(script_path);
-    SAFE_FREE(professor_arg_quoted);
+    gtk_label_set_text(GTK_LABEL(status_label), "Pronto.");
+    gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(progress_bar), 1.0);
+    gchar *progress_text_100 = g_strdup_printf("%d%%", 100);
+    gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progress_bar), progress_text_100);
+    SAFE_FREE(progress_text_100);
+
+    g_print("Scheduling auto-reload of professor after saving changes...\n");
+    g_idle_add(on_professor_selected_idle_wrapper, professor_combo);
 }
 
 /**
@@ -1968,7 +5188,7 @@ void on_save_all_entries(GtkWidget *button, gpointer user_data) {
 
     gint total_pdfs_to_save = 0;
     for (gint i = 0; i < global_num_categories; i++) {
-        total_pdfs_to_save += g_list_length(global_sections[i].entries);
+        total_pdfs_to_save += (gint)global_sections[i].entries->len;
     }
 
     if (total_pdfs_to_save == 0) {
@@ -1988,82 +5208,32 @@ void on_save_all_entries(GtkWidget *button, gpointer user_data) {
         return;
     }
 
-    gchar *exiftool_path = g_find_program_in_path("exiftool");
-    if (!exiftool_path) {
-        GtkWidget *dialog = gtk_message_dialog_new(NULL,
-                                                   GTK_DIALOG_MODAL,
-                                                   GTK_MESSAGE_ERROR,
-                                                   GTK_BUTTONS_OK,
-                                                   "Erro: O programa 'exiftool' não foi encontrado no seu PATH.\n"
-                                                   "Não foi possível salvar os metadados dos PDFs. Por favor, instale-o (sudo apt install libimage-exiftool-perl) e tente novamente.");
-        gtk_dialog_run(GTK_DIALOG(dialog));
-        gtk_widget_destroy(dialog);
-        gtk_label_set_text(GTK_LABEL(status_label), "Erro: exiftool ausente.");
-        gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(progress_bar), 0.0);
-        gchar *progress_text_error = g_strdup_printf("Erro!");
-        gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progress_bar), progress_text_error);
-        SAFE_FREE(progress_text_error);
-        g_main_context_iteration(NULL, FALSE);
-        SAFE_FREE(exiftool_path);
+    // Covers the old exiftool-in-PATH check plus field/file/counter
+    // problems that prepare_save_job would otherwise skip one by one.
+    if (!preflight_check_or_abort("O salvamento")) {
         return;
     }
-    SAFE_FREE(exiftool_path);
 
-    gint saved_pdfs_count = 0;
-    for (gint i = 0; i < global_num_categories; i++) {
-        GList *l;
-        for (l = global_sections[i].entries; l != NULL; l = g_list_next(l)) {
-            PdfEntry *entry = (PdfEntry *)l->data;
-            if (save_single_pdf_entry(entry, professor, i)) {
-                saved_pdfs_count++;
-            } else {
-                g_warning("Failed to save PDF entry during 'Salvar Alterações': %s", entry->file_path ? entry->file_path : "N/A");
-            }
+    gint dispatched = save_all_entries_async(professor, 0.0, 1.0, save_all_entries_done);
 
-            gdouble fraction = (gdouble)saved_pdfs_count / total_pdfs_to_save;
-            gchar *progress_text = g_strdup_printf("Salvando PDF %d de %d: %s",
-                                                   saved_pdfs_count, total_pdfs_to_save, gtk_entry_get_text(GTK_ENTRY(entry->title_entry)));
-            gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(progress_bar), fraction);
-            gchar *progress_percent_text = g_strdup_printf("%d%%", (gint)(fraction * 100));
-            gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progress_bar), progress_percent_text);
-            SAFE_FREE(progress_percent_text);
-            gtk_label_set_text(GTK_LABEL(status_label), progress_text);
-            SAFE_FREE(progress_text);
-            g_main_context_iteration(NULL, FALSE);
-        }
+    if (dispatched < 0) {
+        gtk_label_set_text(GTK_LABEL(status_label), "Salvamento já em andamento. Aguarde a conclusão.");
+        return;
     }
 
-    GtkWidget *dialog = gtk_message_dialog_new(NULL,
-                                               GTK_DIALOG_MODAL,
-                                               GTK_MESSAGE_INFO,
-                                               GTK_BUTTONS_OK,
-                                               "Alterações salvas com sucesso!");
-    gtk_dialog_run(GTK_DIALOG(dialog));
-    gtk_widget_destroy(dialog);
-
-    gchar *sanitized_professor_name = sanitize_filename(professor);
-    gchar *pdf_filename = g_strdup_printf("final/%s_relatorio_profissional.pdf", sanitized_professor_name);
-    if (g_file_test(pdf_filename, G_FILE_TEST_EXISTS)) {
-        if (preview_report_btn) {
-            gtk_widget_show(preview_report_btn);
-        }
-    } else {
-        if (preview_report_btn) {
-            gtk_widget_hide(preview_report_btn);
-        }
+    if (dispatched == 0) {
+        GtkWidget *dialog = gtk_message_dialog_new(NULL,
+                                                   GTK_DIALOG_MODAL,
+                                                   GTK_MESSAGE_WARNING,
+                                                   GTK_BUTTONS_OK,
+                                                   "Nenhum PDF pôde ser salvo. Verifique se os campos de título, ano e categoria estão preenchidos.");
+        gtk_dialog_run(GTK_DIALOG(dialog));
+        gtk_widget_destroy(dialog);
+        gtk_label_set_text(GTK_LABEL(status_label), "Pronto.");
+        return;
     }
-    SAFE_FREE(pdf_filename);
-    SAFE_FREE(sanitized_professor_name);
-
-    gtk_label_set_text(GTK_LABEL(status_label), "Pronto.");
-    gtk_progress_bar_set_fraction(GTK_PROGRESS_BAR(progress_bar), 1.0);
-    gchar *progress_text_100 = g_strdup_printf("%d%%", 100);
-    gtk_progress_bar_set_text(GTK_PROGRESS_BAR(progress_bar), progress_text_100);
-    SAFE_FREE(progress_text_100);
-    g_main_context_iteration(NULL, FALSE);
 
-    g_print("Scheduling auto-reload of professor after saving changes...\n");
-    g_idle_add(on_professor_selected_idle_wrapper, professor_combo);
+    g_print("Dispatched %d of %d PDFs for saving.\n", dispatched, total_pdfs_to_save);
 }
 
 /**
@@ -2158,6 +5328,305 @@ void on_create_professor_folder_clicked(GtkWidget *button, gpointer user_data) {
     on_professor_selected(GTK_COMBO_BOX(professor_combo), NULL);
 }
 
+// =============================================================================
+// EMBEDDED PDF PREVIEW (poppler-glib)
+// =============================================================================
+
+#ifdef HAVE_POPPLER
+
+// First-page preview rendered into a sidebar, backed by an LRU cache of
+// cairo surfaces keyed by (path, mtime) so a re-preview never re-renders.
+// Rendering runs on a single worker thread; a generation counter discards
+// results for entries the user has already moved past. Cache size comes
+// from REPORT_GUI_PREVIEW_CACHE (default 32 pages).
+
+#define PREVIEW_RENDER_WIDTH 380
+#define PREVIEW_CACHE_DEFAULT 32
+
+static GtkWidget *preview_sidebar = NULL;
+static GtkWidget *preview_image = NULL;
+static GtkWidget *preview_title_label = NULL;
+static gchar *preview_current_path = NULL;
+
+typedef struct {
+    gchar *key;                  /* "path|mtime" */
+    cairo_surface_t *surface;
+} PreviewCacheEntry;
+
+static GQueue preview_cache_lru = G_QUEUE_INIT;  /* head = most recent */
+static GHashTable *preview_cache_index = NULL;   /* key -> GList* into lru */
+static gint preview_cache_limit = PREVIEW_CACHE_DEFAULT;
+static GThreadPool *preview_pool = NULL;
+static guint preview_generation = 0;
+
+typedef struct {
+    gchar *path;
+    gchar *title;
+    gchar *key;
+    guint generation;
+    cairo_surface_t *surface;    /* filled in by the worker */
+    gchar *error_text;
+} PreviewJob;
+
+static void preview_job_free(PreviewJob *job) {
+    SAFE_FREE(job->path);
+    SAFE_FREE(job->title);
+    SAFE_FREE(job->key);
+    SAFE_FREE(job->error_text);
+    if (job->surface) {
+        cairo_surface_destroy(job->surface);
+        job->surface = NULL;
+    }
+    SAFE_FREE(job);
+}
+
+/**
+ * @brief Cache hit: returns the surface and promotes its entry to the
+ * front of the LRU queue. NULL on miss.
+ */
+static cairo_surface_t* preview_cache_lookup(const gchar *key) {
+    if (!preview_cache_index) return NULL;
+    GList *link = g_hash_table_lookup(preview_cache_index, key);
+    if (!link) return NULL;
+
+    g_queue_unlink(&preview_cache_lru, link);
+    g_queue_push_head_link(&preview_cache_lru, link);
+    return ((PreviewCacheEntry*)link->data)->surface;
+}
+
+/**
+ * @brief Inserts a rendered surface (takes a reference), evicting from
+ * the LRU tail once the configured limit is reached.
+ */
+static void preview_cache_insert(const gchar *key, cairo_surface_t *surface) {
+    if (!preview_cache_index) {
+        preview_cache_index = g_hash_table_new(g_str_hash, g_str_equal);
+
+        const gchar *limit_env = g_getenv("REPORT_GUI_PREVIEW_CACHE");
+        if (limit_env && *limit_env != '\0') {
+            gint limit = atoi(limit_env);
+            if (limit > 0) preview_cache_limit = limit;
+        }
+    }
+    if (g_hash_table_lookup(preview_cache_index, key)) return;
+
+    while (g_queue_get_length(&preview_cache_lru) >= (guint)preview_cache_limit) {
+        PreviewCacheEntry *evicted = g_queue_pop_tail(&preview_cache_lru);
+        g_hash_table_remove(preview_cache_index, evicted->key);
+        cairo_surface_destroy(evicted->surface);
+        SAFE_FREE(evicted->key);
+        SAFE_FREE(evicted);
+    }
+
+    PreviewCacheEntry *cache_entry = g_new0(PreviewCacheEntry, 1);
+    cache_entry->key = g_strdup(key);
+    cache_entry->surface = cairo_surface_reference(surface);
+    g_queue_push_head(&preview_cache_lru, cache_entry);
+    g_hash_table_insert(preview_cache_index, cache_entry->key,
+                        g_queue_peek_head_link(&preview_cache_lru));
+}
+
+/**
+ * @brief Main-thread delivery of a finished render: caches the surface
+ * and shows it unless the user has previewed something newer meanwhile.
+ */
+static gboolean preview_render_done_idle(gpointer data) {
+    PreviewJob *job = data;
+
+    if (job->surface) {
+        preview_cache_insert(job->key, job->surface);
+    }
+
+    if (job->generation == preview_generation) {
+        if (job->surface) {
+            gtk_image_set_from_surface(GTK_IMAGE(preview_image), job->surface);
+            gtk_label_set_text(GTK_LABEL(preview_title_label), job->title);
+        } else {
+            gtk_label_set_text(GTK_LABEL(preview_title_label),
+                               job->error_text ? job->error_text : "Falha ao renderizar o PDF.");
+        }
+    }
+
+    preview_job_free(job);
+    return G_SOURCE_REMOVE;
+}
+
+/**
+ * @brief Worker-thread render of a PDF's first page at sidebar width.
+ */
+static void preview_render_worker(gpointer data, gpointer user_data) {
+    (void)user_data;
+    PreviewJob *job = data;
+
+    GError *error = NULL;
+    gchar *uri = g_filename_to_uri(job->path, NULL, &error);
+    PopplerDocument *document = uri ? poppler_document_new_from_file(uri, NULL, &error) : NULL;
+
+    if (document) {
+        PopplerPage *page = poppler_document_get_page(document, 0);
+        if (page) {
+            gdouble page_width = 0, page_height = 0;
+            poppler_page_get_size(page, &page_width, &page_height);
+            gdouble scale = (page_width > 0) ? (PREVIEW_RENDER_WIDTH / page_width) : 1.0;
+
+            job->surface = cairo_image_surface_create(CAIRO_FORMAT_ARGB32,
+                                                      PREVIEW_RENDER_WIDTH,
+                                                      (gint)(page_height * scale));
+            cairo_t *cr = cairo_create(job->surface);
+            cairo_set_source_rgb(cr, 1.0, 1.0, 1.0);
+            cairo_paint(cr);
+            cairo_scale(cr, scale, scale);
+            poppler_page_render(page, cr);
+            cairo_destroy(cr);
+            g_object_unref(page);
+        } else {
+            job->error_text = g_strdup("PDF sem páginas.");
+        }
+        g_object_unref(document);
+    } else {
+        job->error_text = g_strdup_printf("Falha ao abrir o PDF: %s",
+                                          error ? error->message : "N/A");
+    }
+    if (error) g_error_free(error);
+    SAFE_FREE(uri);
+
+    g_idle_add(preview_render_done_idle, job);
+}
+
+/**
+ * @brief Shows a PDF's first page in the sidebar: instant on cache hit,
+ * otherwise queues a render on the worker thread.
+ */
+static void preview_show_path(const gchar *path, const gchar *title) {
+    GStatBuf preview_stat;
+    if (g_stat(path, &preview_stat) != 0) {
+        g_warning("Could not stat PDF for preview: %s", path);
+        return;
+    }
+    gchar *key = g_strdup_printf("%s|%" G_GINT64_FORMAT, path, (gint64)preview_stat.st_mtime);
+
+    preview_generation++;
+    SAFE_FREE(preview_current_path);
+    preview_current_path = g_strdup(path);
+    gtk_widget_show(preview_sidebar);
+
+    cairo_surface_t *cached = preview_cache_lookup(key);
+    if (cached) {
+        gtk_image_set_from_surface(GTK_IMAGE(preview_image), cached);
+        gtk_label_set_text(GTK_LABEL(preview_title_label), title);
+        SAFE_FREE(key);
+        return;
+    }
+
+    gtk_image_clear(GTK_IMAGE(preview_image));
+    gtk_label_set_text(GTK_LABEL(preview_title_label), "Renderizando...");
+
+    if (!preview_pool) {
+        GError *pool_error = NULL;
+        preview_pool = g_thread_pool_new(preview_render_worker, NULL, 1, TRUE, &pool_error);
+        if (!preview_pool) {
+            g_warning("Could not create preview thread pool: %s",
+                      pool_error ? pool_error->message : "unknown");
+            if (pool_error) g_error_free(pool_error);
+            SAFE_FREE(key);
+            return;
+        }
+    }
+
+    PreviewJob *job = g_new0(PreviewJob, 1);
+    job->path = g_strdup(path);
+    job->title = g_strdup(title);
+    job->key = key;
+    job->generation = preview_generation;
+    g_thread_pool_push(preview_pool, job, NULL);
+}
+
+/**
+ * @brief Secondary action: hands the previewed PDF to the external viewer.
+ */
+static void on_preview_open_external(GtkWidget *button, gpointer user_data) {
+    (void)button;
+    (void)user_data;
+    if (!preview_current_path) return;
+
+    GError *error = NULL;
+    gchar *command_line = g_strdup_printf("xdg-open \"%s\"", preview_current_path);
+    if (!g_spawn_command_line_async(command_line, &error)) {
+        g_warning("Failed to open external viewer: %s", error ? error->message : "N/A");
+        if (error) g_error_free(error);
+    }
+    SAFE_FREE(command_line);
+}
+
+static void on_preview_close(GtkWidget *button, gpointer user_data) {
+    (void)button;
+    (void)user_data;
+    gtk_widget_hide(preview_sidebar);
+}
+
+/**
+ * @brief Builds the (initially hidden) preview sidebar.
+ */
+static GtkWidget* preview_sidebar_build(void) {
+    preview_sidebar = gtk_box_new(GTK_ORIENTATION_VERTICAL, 5);
+    gtk_container_set_border_width(GTK_CONTAINER(preview_sidebar), 5);
+    gtk_widget_set_size_request(preview_sidebar, PREVIEW_RENDER_WIDTH + 20, -1);
+
+    preview_title_label = gtk_label_new("");
+    gtk_label_set_ellipsize(GTK_LABEL(preview_title_label), PANGO_ELLIPSIZE_MIDDLE);
+    gtk_box_pack_start(GTK_BOX(preview_sidebar), preview_title_label, FALSE, FALSE, 0);
+
+    GtkWidget *image_scrolled_window = gtk_scrolled_window_new(NULL, NULL);
+    gtk_scrolled_window_set_policy(GTK_SCROLLED_WINDOW(image_scrolled_window),
+                                   GTK_POLICY_AUTOMATIC, GTK_POLICY_AUTOMATIC);
+    preview_image = gtk_image_new();
+    gtk_container_add(GTK_CONTAINER(image_scrolled_window), preview_image);
+    gtk_box_pack_start(GTK_BOX(preview_sidebar), image_scrolled_window, TRUE, TRUE, 0);
+
+    GtkWidget *preview_buttons_hbox = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 5);
+    gtk_widget_set_halign(preview_buttons_hbox, GTK_ALIGN_CENTER);
+
+    GtkWidget *external_btn = gtk_button_new_with_label("Abrir Externo");
+    g_signal_connect(external_btn, "clicked", G_CALLBACK(on_preview_open_external), NULL);
+    gtk_box_pack_start(GTK_BOX(preview_buttons_hbox), external_btn, FALSE, FALSE, 0);
+
+    GtkWidget *close_btn = gtk_button_new_with_label("Fechar");
+    g_signal_connect(close_btn, "clicked", G_CALLBACK(on_preview_close), NULL);
+    gtk_box_pack_start(GTK_BOX(preview_buttons_hbox), close_btn, FALSE, FALSE, 0);
+
+    gtk_box_pack_start(GTK_BOX(preview_sidebar), preview_buttons_hbox, FALSE, FALSE, 0);
+
+    // Stays hidden until the first preview; show_all must not reveal it.
+    gtk_widget_set_no_show_all(preview_sidebar, TRUE);
+    gtk_widget_show_all(preview_title_label);
+    gtk_widget_show_all(image_scrolled_window);
+    gtk_widget_show_all(preview_buttons_hbox);
+    return preview_sidebar;
+}
+
+/**
+ * @brief Frees the cache and drains the render pool (process exit).
+ */
+static void preview_shutdown(void) {
+    if (preview_pool) {
+        g_thread_pool_free(preview_pool, TRUE, TRUE);
+        preview_pool = NULL;
+    }
+    PreviewCacheEntry *cache_entry;
+    while ((cache_entry = g_queue_pop_tail(&preview_cache_lru)) != NULL) {
+        cairo_surface_destroy(cache_entry->surface);
+        SAFE_FREE(cache_entry->key);
+        SAFE_FREE(cache_entry);
+    }
+    if (preview_cache_index) {
+        g_hash_table_destroy(preview_cache_index);
+        preview_cache_index = NULL;
+    }
+    SAFE_FREE(preview_current_path);
+}
+
+#endif /* HAVE_POPPLER */
+
 /**
  * @brief Opens the PDF associated with a PdfEntry.
  */
@@ -2200,6 +5669,14 @@ void on_preview_pdf(GtkWidget *button, PdfEntry *entry) {
         return;
     }
 
+#ifdef HAVE_POPPLER
+    g_print("Previewing PDF in sidebar: %s\n", entry->file_path);
+    const gchar *title = pdf_entry_get_title(entry);
+    gchar *preview_title = g_path_get_basename(entry->file_path);
+    preview_show_path(entry->file_path,
+                      (title && *title != '\0') ? title : preview_title);
+    SAFE_FREE(preview_title);
+#else
     g_print("Attempting to open PDF for preview: %s\n", entry->file_path);
     GError *error = NULL;
     gchar *command_line = g_strdup_printf("xdg-open \"%s\"", entry->file_path);
@@ -2217,6 +5694,7 @@ void on_preview_pdf(GtkWidget *button, PdfEntry *entry) {
         g_print("PDF opened successfully for preview.\n");
     }
     SAFE_FREE(command_line);
+#endif
 }
 
 /**
@@ -2301,6 +5779,11 @@ void on_reload_professor_button_clicked(GtkWidget *button, gpointer user_data) {
     (void)user_data;
 
     g_print("Reload professor button clicked. Triggering on_professor_selected.\n");
+
+    // An explicit reload must hit the filesystem, not the session snapshot.
+    const gchar *professor = gtk_combo_box_text_get_active_text(GTK_COMBO_BOX_TEXT(professor_combo));
+    professor_snapshot_drop(professor);
+
     on_professor_selected(GTK_COMBO_BOX(professor_combo), NULL);
 }
 
@@ -2512,18 +5995,261 @@ void on_help_button_clicked(GtkWidget *button, gpointer user_data) {
     gtk_widget_destroy(dialog);
 }
 
+// =============================================================================
+// HEADLESS MODE
+// =============================================================================
+
+/**
+ * @brief Counts PDFs in one category folder of a professor (no GTK involved).
+ */
+static gint headless_count_category_pdfs(const gchar *professor, const gchar *category) {
+    gchar *folder = g_strdup_printf("./%s/%s", professor, category);
+    GDir *dir = g_dir_open(folder, 0, NULL);
+    gint count = 0;
+
+    if (dir) {
+        const gchar *name;
+        while ((name = g_dir_read_name(dir)) != NULL) {
+            if (filename_has_pdf_suffix(name)) {
+                count++;
+            }
+        }
+        g_dir_close(dir);
+    }
+
+    SAFE_FREE(folder);
+    return count;
+}
+
+/**
+ * @brief Reconciles the Category tag of every PDF in a category folder.
+ *
+ * Writes the folder's category into any PDF whose tag is missing or
+ * different, mirroring what the save pipeline does for GUI-edited entries.
+ * One exiftool invocation per folder; untouched files are skipped by -if.
+ */
+static void headless_reconcile_category(const gchar *professor, const gchar *category) {
+    gchar *folder = g_strdup_printf("./%s/%s", professor, category);
+    gchar *condition = g_strdup_printf("not defined $Category or $Category ne q{%s}", category);
+    gchar *category_arg = g_strdup_printf("-Category=%s", category);
+
+    gchar *argv_exif[] = {
+        g_strdup("exiftool"),
+        g_strdup("-q"),
+        g_strdup("-overwrite_original_in_place"),
+        g_strdup("-ext"), g_strdup("pdf"),
+        g_strdup("-if"), condition,
+        category_arg,
+        folder,
+        NULL
+    };
+
+    GError *error = NULL;
+    gint exit_status = 0;
+    if (!g_spawn_sync(NULL, argv_exif, NULL, G_SPAWN_SEARCH_PATH,
+                      NULL, NULL, NULL, NULL, &exit_status, &error)) {
+        g_printerr("HEADLESS professor=%s event=error reason=reconcile detail=%s\n",
+                   professor, error ? error->message : "N/A");
+        if (error) g_error_free(error);
+    }
+    // exiftool exits 2 when every file was skipped by -if; that simply means
+    // the folder was already consistent, so only a spawn failure is reported.
+
+    for (gint i = 0; argv_exif[i] != NULL; i++) {
+        SAFE_FREE(argv_exif[i]);
+    }
+}
+
+/**
+ * @brief Runs the backend script for one professor, relaying its progress.
+ *
+ * The script's "PROGRESS: N" stdout protocol is re-emitted as machine-readable
+ * "HEADLESS ... event=progress" lines. Returns the script's exit code, or -1
+ * if it could not be spawned.
+ */
+static gint headless_run_backend(const gchar *professor) {
+    gchar *argv_backend[] = {
+        g_strdup("bash"),
+        g_strdup(BACKEND_SCRIPT_PATH),
+        g_strdup(professor),
+        NULL
+    };
+
+    GPid child_pid;
+    gint stdout_fd = -1;
+    GError *spawn_error = NULL;
+
+    if (!g_spawn_async_with_pipes(NULL, argv_backend, NULL,
+                                  G_SPAWN_SEARCH_PATH | G_SPAWN_DO_NOT_REAP_CHILD,
+                                  NULL, NULL, &child_pid,
+                                  NULL, &stdout_fd, NULL, &spawn_error)) {
+        g_printerr("HEADLESS professor=%s event=error reason=spawn detail=%s\n",
+                   professor, spawn_error ? spawn_error->message : "N/A");
+        if (spawn_error) g_error_free(spawn_error);
+        for (gint i = 0; argv_backend[i] != NULL; i++) {
+            SAFE_FREE(argv_backend[i]);
+        }
+        return -1;
+    }
+
+    for (gint i = 0; argv_backend[i] != NULL; i++) {
+        SAFE_FREE(argv_backend[i]);
+    }
+
+    FILE *out = fdopen(stdout_fd, "r");
+    if (out) {
+        gchar *line = NULL;
+        gsize len = 0;
+        gint value;
+        while (getline(&line, &len, out) != -1) {
+            line[strcspn(line, "\n")] = 0;
+            if (sscanf(line, "PROGRESS: %d", &value) == 1) {
+                g_print("HEADLESS professor=%s event=progress value=%d\n", professor, value);
+                fflush(stdout);
+            }
+        }
+        SAFE_FREE(line);
+        fclose(out);
+    } else {
+        close(stdout_fd);
+    }
+
+    gint wstatus = 0;
+    waitpid(child_pid, &wstatus, 0);
+    g_spawn_close_pid(child_pid);
+
+    if (WIFEXITED(wstatus)) {
+        return WEXITSTATUS(wstatus);
+    }
+    return -1;
+}
+
+/**
+ * @brief Entry point for --headless: scan, reconcile and generate reports.
+ *
+ * Takes a professor name or "all". No GTK initialization, no terminal
+ * spawning; progress and outcomes go to stdout as "HEADLESS key=value" lines
+ * so cron jobs and wrapper scripts can parse them.
+ */
+gint headless_main(const gchar *target) {
+    trace_init();
+    g_mkdir_with_parents("config", 0755);
+    g_mkdir_with_parents("final", 0755);
+
+    // No dialogs in headless mode: report an interrupted save and leave
+    // the journal in place for an interactive session to resolve.
+    if (g_file_test("./.save_journal", G_FILE_TEST_EXISTS)) {
+        g_printerr("HEADLESS event=warning reason=incomplete_save_journal\n");
+    }
+
+    if (!load_categories_from_file("config/categories.txt")) {
+        g_printerr("HEADLESS event=fatal reason=categories_file\n");
+        return 1;
+    }
+
+    GPtrArray *professors = g_ptr_array_new_with_free_func(g_free);
+
+    if (g_strcmp0(target, "all") == 0) {
+        gchar *file_content = NULL;
+        if (g_file_get_contents("config/professores.txt", &file_content, NULL, NULL)) {
+            gchar **lines = g_strsplit(file_content, "\n", -1);
+            for (gint i = 0; lines[i] != NULL; i++) {
+                gchar *name = g_strstrip(lines[i]);
+                if (*name != '\0') {
+                    g_ptr_array_add(professors, g_strdup(name));
+                }
+            }
+            g_strfreev(lines);
+            SAFE_FREE(file_content);
+        }
+        if (professors->len == 0) {
+            g_printerr("HEADLESS event=fatal reason=professors_file\n");
+            g_ptr_array_free(professors, TRUE);
+            return 1;
+        }
+    } else {
+        g_ptr_array_add(professors, g_strdup(target));
+    }
+
+    gint failures = 0;
+
+    for (guint p = 0; p < professors->len; p++) {
+        const gchar *professor = g_ptr_array_index(professors, p);
+
+        gchar *professor_dir = g_strdup_printf("./%s", professor);
+        gboolean exists = is_valid_path(professor_dir) &&
+                          g_file_test(professor_dir, G_FILE_TEST_IS_DIR);
+        SAFE_FREE(professor_dir);
+
+        if (!exists) {
+            g_print("HEADLESS professor=%s event=skipped reason=missing_dir\n", professor);
+            fflush(stdout);
+            continue;
+        }
+
+        gint total_pdfs = 0;
+        for (gint i = 0; i < global_num_categories; i++) {
+            gint count = headless_count_category_pdfs(professor, global_categories[i]);
+            total_pdfs += count;
+            if (count > 0) {
+                headless_reconcile_category(professor, global_categories[i]);
+            }
+        }
+        g_print("HEADLESS professor=%s event=scan categories=%d pdfs=%d\n",
+                professor, global_num_categories, total_pdfs);
+        fflush(stdout);
+
+        if (total_pdfs == 0) {
+            g_print("HEADLESS professor=%s event=skipped reason=no_pdfs\n", professor);
+            fflush(stdout);
+            continue;
+        }
+
+        gint status = headless_run_backend(professor);
+        g_print("HEADLESS professor=%s event=done status=%d\n", professor, status);
+        fflush(stdout);
+
+        if (status != 0) {
+            failures++;
+        }
+    }
+
+    g_ptr_array_free(professors, TRUE);
+    trace_dump_summary();
+    return failures > 0 ? 1 : 0;
+}
+
 // =============================================================================
 // MAIN APPLICATION FUNCTION
 // =============================================================================
 
 int main(int argc, char *argv[]) {
     setlocale(LC_ALL, "");
+    trace_init();
+
+    // --headless runs scan + reconciliation + backend generation without any
+    // GTK or display setup: report_gui --headless <professor|all>
+    if (argc >= 2 && g_strcmp0(argv[1], "--headless") == 0) {
+        if (argc < 3) {
+            g_printerr("Uso: %s --headless <professor|all>\n", argv[0]);
+            return 2;
+        }
+        return headless_main(argv[2]);
+    }
 
     gtk_init(&argc, &argv);
 
     g_mkdir_with_parents("config", 0755);
     g_mkdir_with_parents("final", 0755);
 
+    // An interrupted save from a previous session leaves its journal
+    // behind; resolve it before anything touches the archive.
+    save_journal_recover();
+
+    // Start the persistent exiftool worker once; every metadata read during the
+    // session goes through it instead of paying a process startup per file.
+    exiftool_daemon_start();
+
     if (!load_categories_from_file("config/categories.txt")) {
         GtkWidget *dialog = gtk_message_dialog_new(NULL,
                                                    GTK_DIALOG_MODAL,
@@ -2571,6 +6297,10 @@ int main(int argc, char *argv[]) {
     g_signal_connect(help_btn, "clicked", G_CALLBACK(on_help_button_clicked), NULL);
     gtk_box_pack_start(GTK_BOX(top_buttons_hbox), help_btn, FALSE, FALSE, 0);
 
+    GtkWidget *stats_btn = gtk_button_new_with_label("Exportar Estatísticas");
+    g_signal_connect(stats_btn, "clicked", G_CALLBACK(export_category_statistics), NULL);
+    gtk_box_pack_start(GTK_BOX(top_buttons_hbox), stats_btn, FALSE, FALSE, 0);
+
     GtkWidget *reload_professor_btn = gtk_button_new_with_label("Recarregar Professor");
     g_signal_connect(reload_professor_btn, "clicked", G_CALLBACK(on_reload_professor_button_clicked), NULL);
     gtk_box_pack_start(GTK_BOX(top_buttons_hbox), reload_professor_btn, FALSE, FALSE, 0);
@@ -2597,13 +6327,22 @@ int main(int argc, char *argv[]) {
     main_category_scrolled_window = gtk_scrolled_window_new(NULL, NULL);
     gtk_scrolled_window_set_policy(GTK_SCROLLED_WINDOW(main_category_scrolled_window),
                                    GTK_POLICY_AUTOMATIC, GTK_POLICY_AUTOMATIC);
+#ifdef HAVE_POPPLER
+    GtkWidget *content_paned = gtk_paned_new(GTK_ORIENTATION_HORIZONTAL);
+    gtk_paned_pack1(GTK_PANED(content_paned), main_category_scrolled_window, TRUE, FALSE);
+    gtk_paned_pack2(GTK_PANED(content_paned), preview_sidebar_build(), FALSE, FALSE);
+    gtk_paned_pack2(GTK_PANED(hpaned), content_paned, TRUE, FALSE);
+#else
     gtk_paned_pack2(GTK_PANED(hpaned), main_category_scrolled_window, TRUE, FALSE);
+#endif
 
     category_content_vbox = gtk_box_new(GTK_ORIENTATION_VERTICAL, 10);
     gtk_container_add(GTK_CONTAINER(main_category_scrolled_window), category_content_vbox);
     gtk_container_set_border_width(GTK_CONTAINER(category_content_vbox), 5);
 
-    create_category_gui(category_nav_list_box, category_content_vbox);
+    // Deferred: the window maps with just the selector live; the category
+    // frames are built from an idle once the main loop is running.
+    g_idle_add(create_category_gui_idle, NULL);
 
     GtkWidget *bottom_buttons_hbox = gtk_box_new(GTK_ORIENTATION_HORIZONTAL, 10);
     gtk_widget_set_halign(bottom_buttons_hbox, GTK_ALIGN_CENTER);
@@ -2638,6 +6377,20 @@ int main(int argc, char *argv[]) {
     gtk_widget_show_all(window);
     gtk_main();
 
+    trace_dump_summary();
+    exiftool_daemon_shutdown();
+    if (save_pool) {
+        g_thread_pool_free(save_pool, TRUE, TRUE);
+        save_pool = NULL;
+    }
+    if (move_pool) {
+        // FALSE: finish queued moves before exiting, don't drop them
+        g_thread_pool_free(move_pool, FALSE, TRUE);
+        move_pool = NULL;
+    }
+#ifdef HAVE_POPPLER
+    preview_shutdown();
+#endif
     cleanup_category_gui();
     if (global_categories) {
         for (gint i = 0; i < global_num_categories; i++) {
@@ -2646,6 +6399,7 @@ int main(int argc, char *argv[]) {
         SAFE_FREE(global_categories);
     }
     SAFE_FREE(global_max_category_counters);
+    SAFE_FREE(global_category_total_bytes);
 
     return 0;
 }